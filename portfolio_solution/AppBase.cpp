@@ -431,6 +431,22 @@ bool AppBase::UpdateMouseControl(const BoundingSphere &bs, Quaternion &q,
     return false;
 }
 
+DirectX::SimpleMath::Ray AppBase::GetCursorRay() {
+
+    // NDC 커서 위치를 월드 좌표계로 역변환 해주는 행렬
+    const Matrix inverseProjView =
+        (m_camera.GetViewRow() * m_camera.GetProjRow()).Invert();
+
+    const Vector3 cursorWorldNear = Vector3::Transform(
+        Vector3(m_cursorNdcX, m_cursorNdcY, 0.0f), inverseProjView);
+    const Vector3 cursorWorldFar = Vector3::Transform(
+        Vector3(m_cursorNdcX, m_cursorNdcY, 1.0f), inverseProjView);
+    Vector3 dir = cursorWorldFar - cursorWorldNear;
+    dir.Normalize();
+
+    return SimpleMath::Ray(cursorWorldNear, dir);
+}
+
 bool AppBase::InitMainWindow() {
 
     WNDCLASSEX wc = {sizeof(WNDCLASSEX),
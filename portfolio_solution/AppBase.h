@@ -50,6 +50,9 @@ class AppBase {
     bool UpdateMouseControl(const BoundingSphere &bs, Quaternion &q,
                             Vector3 &dragTranslation, Vector3 &pickPoint);
 
+    // 커서 위치에서 화면 안쪽으로 향하는 월드 공간 광선 (방향은 정규화)
+    DirectX::SimpleMath::Ray GetCursorRay();
+
   protected: // 상속 받은 클래스에서도 접근 가능
     bool InitMainWindow();
     bool InitDirect3D();
@@ -9,10 +9,23 @@ cbuffer MeshConstants : register(b0)
     int useHeightMap;
     float heightScale;
     float2 dummy;
+    float3 positionMin;    // PackedVertex의 위치 복원
+    float dummy1;
+    float3 positionExtent;
+    float dummy2;
 };
 
+#ifdef PACKED_VERTEX
+PixelShaderInput main(PackedVertexShaderInput packedInput)
+#else
 PixelShaderInput main(VertexShaderInput input)
+#endif
 {
+#ifdef PACKED_VERTEX
+    VertexShaderInput input =
+        UnpackVertex(packedInput, positionMin, positionExtent);
+#endif
+
     // 뷰 좌표계는 NDC이기 때문에 월드 좌표를 이용해서 조명 계산
     
     PixelShaderInput output;
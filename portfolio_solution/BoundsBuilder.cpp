@@ -0,0 +1,140 @@
+#include "BoundsBuilder.h"
+
+#include <cfloat>
+
+namespace Moon {
+
+using namespace std;
+using namespace DirectX;
+
+namespace {
+
+MeshBounds FromAabb(const Vector3 &vmin, const Vector3 &vmax) {
+    MeshBounds bounds;
+    BoundingBox::CreateFromPoints(bounds.aabb, vmin, vmax);
+    BoundingOrientedBox::CreateFromBoundingBox(bounds.obb, bounds.aabb);
+    bounds.sphere.Center = bounds.aabb.Center;
+    bounds.sphere.Radius = Vector3(bounds.aabb.Extents).Length();
+    bounds.isValid = 1;
+    return bounds;
+}
+
+float Volume(const XMFLOAT3 &extents) {
+    return extents.x * extents.y * extents.z;
+}
+
+} // namespace
+
+void BoundsBuilder::MinMax(const vector<Vertex> &vertices, Vector3 &vmin,
+                           Vector3 &vmax) {
+
+    // 누적 변수 두 쌍으로 의존성을 나눠서 파이프라인을 채움
+    XMVECTOR min0 = XMVectorReplicate(FLT_MAX), min1 = min0;
+    XMVECTOR max0 = XMVectorReplicate(-FLT_MAX), max1 = max0;
+
+    size_t i = 0;
+    for (; i + 2 <= vertices.size(); i += 2) {
+        const XMVECTOR p0 = XMLoadFloat3(&vertices[i].position);
+        const XMVECTOR p1 = XMLoadFloat3(&vertices[i + 1].position);
+        min0 = XMVectorMin(min0, p0);
+        max0 = XMVectorMax(max0, p0);
+        min1 = XMVectorMin(min1, p1);
+        max1 = XMVectorMax(max1, p1);
+    }
+    if (i < vertices.size()) {
+        const XMVECTOR p = XMLoadFloat3(&vertices[i].position);
+        min0 = XMVectorMin(min0, p);
+        max0 = XMVectorMax(max0, p);
+    }
+
+    XMStoreFloat3(&vmin, XMVectorMin(min0, min1));
+    XMStoreFloat3(&vmax, XMVectorMax(max0, max1));
+}
+
+void BoundsBuilder::NormalizeMinMax(vector<Vertex> &vertices,
+                                    const Vector3 &center, float scale,
+                                    Vector3 &vmin, Vector3 &vmax) {
+
+    const XMVECTOR c = XMLoadFloat3(&center);
+    const XMVECTOR s = XMVectorReplicate(scale);
+
+    XMVECTOR minV = XMVectorReplicate(FLT_MAX);
+    XMVECTOR maxV = XMVectorReplicate(-FLT_MAX);
+    for (auto &v : vertices) {
+        const XMVECTOR p =
+            XMVectorMultiply(XMVectorSubtract(XMLoadFloat3(&v.position), c), s);
+        XMStoreFloat3(&v.position, p);
+        minV = XMVectorMin(minV, p);
+        maxV = XMVectorMax(maxV, p);
+    }
+
+    XMStoreFloat3(&vmin, minV);
+    XMStoreFloat3(&vmax, maxV);
+}
+
+MeshBounds BoundsBuilder::Compute(const vector<Vertex> &vertices,
+                                  const Vector3 &vmin, const Vector3 &vmax,
+                                  bool computeObb) {
+
+    if (vertices.empty()) {
+        return MeshBounds();
+    }
+
+    MeshBounds bounds = FromAabb(vmin, vmax);
+
+    // Ritter 방식의 구가 AABB를 감싸는 구보다 크면 (드물게) 작은 쪽 사용
+    BoundingSphere ritter;
+    BoundingSphere::CreateFromPoints(ritter, vertices.size(),
+                                     &vertices[0].position, sizeof(Vertex));
+    if (ritter.Radius < bounds.sphere.Radius) {
+        bounds.sphere = ritter;
+    }
+
+    // 공분산 행렬의 고유벡터를 축으로 하는 상자, AABB보다 크면 버림
+    if (computeObb) {
+        BoundingOrientedBox obb;
+        BoundingOrientedBox::CreateFromPoints(
+            obb, vertices.size(), &vertices[0].position, sizeof(Vertex));
+        if (Volume(obb.Extents) < Volume(bounds.aabb.Extents)) {
+            bounds.obb = obb;
+        }
+        bounds.hasObb = 1;
+    }
+
+    return bounds;
+}
+
+MeshBounds BoundsBuilder::Compute(const vector<Vertex> &vertices,
+                                  bool computeObb) {
+    Vector3 vmin, vmax;
+    MinMax(vertices, vmin, vmax);
+    return Compute(vertices, vmin, vmax, computeObb);
+}
+
+MeshBounds BoundsBuilder::Merge(const MeshBounds &a, const MeshBounds &b) {
+
+    if (!a.isValid) {
+        return b;
+    }
+    if (!b.isValid) {
+        return a;
+    }
+
+    MeshBounds bounds;
+    BoundingBox::CreateMerged(bounds.aabb, a.aabb, b.aabb);
+    BoundingSphere::CreateMerged(bounds.sphere, a.sphere, b.sphere);
+    BoundingOrientedBox::CreateFromBoundingBox(bounds.obb, bounds.aabb);
+    bounds.isValid = 1;
+    return bounds;
+}
+
+MeshBounds BoundsBuilder::Transform(const MeshBounds &bounds,
+                                    const Matrix &worldRow) {
+    MeshBounds world = bounds;
+    bounds.aabb.Transform(world.aabb, worldRow);
+    bounds.sphere.Transform(world.sphere, worldRow);
+    bounds.obb.Transform(world.obb, worldRow);
+    return world;
+}
+
+} // namespace Moon
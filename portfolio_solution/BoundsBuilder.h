@@ -0,0 +1,55 @@
+#pragma once
+
+#include <DirectXCollision.h>
+#include <directxtk/SimpleMath.h>
+#include <vector>
+
+#include "Vertex.h"
+
+namespace Moon {
+
+using DirectX::SimpleMath::Matrix;
+
+// 메쉬 하나(또는 Model 전체)의 바운딩 볼륨
+// MeshCache에 그대로 저장하므로 포인터 없는 단순한 구조체로 유지
+struct MeshBounds {
+    DirectX::BoundingBox aabb;
+    DirectX::BoundingSphere sphere;   // Ritter
+    DirectX::BoundingOrientedBox obb; // PCA, 계산하지 않았으면 aabb와 같은 상자
+    uint32_t isValid = 0;
+    uint32_t hasObb = 0;
+};
+
+// 버텍스 위치로 MeshBounds 계산
+// 참고: Ritter, "An Efficient Bounding Sphere" (Graphics Gems, 1990)
+// 참고: DirectXCollision BoundingOrientedBox::CreateFromPoints()
+// https://github.com/microsoft/DirectXMath/blob/main/Inc/DirectXCollision.inl
+
+class BoundsBuilder {
+  public:
+    // 모든 버텍스 위치의 최소/최대 (XMVECTOR 단위로 비교)
+    static void MinMax(const std::vector<Vertex> &vertices, Vector3 &vmin,
+                       Vector3 &vmax);
+
+    // position = (position - center) * scale로 옮기면서 같은 루프에서 최소/최대
+    static void NormalizeMinMax(std::vector<Vertex> &vertices,
+                                const Vector3 &center, float scale,
+                                Vector3 &vmin, Vector3 &vmax);
+
+    // 이미 구한 최소/최대로 AABB를 만들고 구와 OBB 계산
+    static MeshBounds Compute(const std::vector<Vertex> &vertices,
+                              const Vector3 &vmin, const Vector3 &vmax,
+                              bool computeObb = true);
+
+    static MeshBounds Compute(const std::vector<Vertex> &vertices,
+                              bool computeObb = true);
+
+    // 두 볼륨을 모두 포함 (OBB는 합친 AABB로 대신함)
+    static MeshBounds Merge(const MeshBounds &a, const MeshBounds &b);
+
+    // 월드 좌표계로 변환 (크기 조절이 있으면 구의 반지름은 가장 큰 축 기준)
+    static MeshBounds Transform(const MeshBounds &bounds,
+                                const Matrix &worldRow);
+};
+
+} // namespace Moon
@@ -20,6 +20,30 @@ Matrix Camera::GetViewRow() {
 
 Vector3 Camera::GetEyePos() { return m_position; }
 
+void Camera::GetFrustumPlanes(Vector4 planes[6]) {
+    ExtractFrustumPlanes(GetViewRow() * GetProjRow(), planes);
+}
+
+// https://www.gamedevs.org/uploads/fast-extraction-viewing-frustum-planes-from-world-view-projection-matrix.pdf
+void Camera::ExtractFrustumPlanes(const Matrix &viewProjRow,
+                                  Vector4 planes[6]) {
+    const Matrix &m = viewProjRow;
+    const Vector4 col0(m._11, m._21, m._31, m._41);
+    const Vector4 col1(m._12, m._22, m._32, m._42);
+    const Vector4 col2(m._13, m._23, m._33, m._43);
+    const Vector4 col3(m._14, m._24, m._34, m._44);
+
+    planes[0] = col3 + col0;
+    planes[1] = col3 - col0;
+    planes[2] = col3 + col1;
+    planes[3] = col3 - col1;
+    planes[4] = col2; // Direct3D의 NDC z는 [0, 1]
+    planes[5] = col3 - col2;
+    for (int i = 0; i < 6; i++) {
+        planes[i] /= Vector3(planes[i].x, planes[i].y, planes[i].z).Length();
+    }
+}
+
 void Camera::UpdateViewDir() {
     // 이동할 때 기준이 되는 정면/오른쪽 방향 계산
     m_viewDir = Vector3::Transform(Vector3(0.0f, 0.0f, 1.0f),
@@ -6,6 +6,7 @@ namespace Moon {
 
 using DirectX::SimpleMath::Matrix;
 using DirectX::SimpleMath::Vector3;
+using DirectX::SimpleMath::Vector4;
 
 class Camera {
   public:
@@ -15,6 +16,14 @@ class Camera {
     Matrix GetProjRow();
     Vector3 GetEyePos();
 
+    // GetViewRow() * GetProjRow()의 절두체 평면 6개
+    void GetFrustumPlanes(Vector4 planes[6]);
+
+    // 절두체 평면 (Gribb-Hartmann, 노멀은 정규화, 안쪽이 양수)
+    // 순서: 왼쪽, 오른쪽, 아래, 위, near, far
+    static void ExtractFrustumPlanes(const Matrix &viewProjRow,
+                                     Vector4 planes[6]);
+
     void UpdateViewDir();
     void UpdateKeyboard(const float dt, bool const keyPressed[256]);
     void UpdateMouse(float mouseNdcX, float mouseNdcY);
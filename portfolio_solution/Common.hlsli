@@ -60,6 +60,36 @@ struct VertexShaderInput
     float3 tangentModel : TANGENT0;
 };
 
+// 압축된 버텍스 (PackedVertex, VertexPacker 참고)
+// PACKED_VERTEX를 정의해서 컴파일한 버텍스 쉐이더에서 사용
+struct PackedVertexShaderInput
+{
+    float4 posUnorm : POSITION;     // AABB 안에서 [0, 1]
+    float2 normalOct : NORMAL0;     // Octahedral
+    float2 tangentOct : TANGENT0;   // Octahedral
+    float2 texcoord : TEXCOORD0;    // half float
+};
+
+// VertexPacker::DecodeOctahedral()과 같은 계산
+float3 DecodeOctahedral(float2 e)
+{
+    float3 n = float3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = saturate(-n.z);
+    n.xy += n.xy >= 0.0 ? -t : t;
+    return normalize(n);
+}
+
+VertexShaderInput UnpackVertex(PackedVertexShaderInput input,
+                               float3 positionMin, float3 positionExtent)
+{
+    VertexShaderInput output;
+    output.posModel = positionMin + input.posUnorm.xyz * positionExtent;
+    output.normalModel = DecodeOctahedral(input.normalOct);
+    output.texcoord = input.texcoord;
+    output.tangentModel = DecodeOctahedral(input.tangentOct);
+    return output;
+}
+
 struct PixelShaderInput
 {
     float4 posProj : SV_POSITION;   // Screen position
@@ -26,6 +26,10 @@ __declspec(align(256)) struct MeshConstants {
     int useHeightMap = 0;
     float heightScale = 0.0f;
     Vector2 dummy;
+    Vector3 positionMin = Vector3(0.0f); // PackedVertex의 위치 복원
+    float dummy1;
+    Vector3 positionExtent = Vector3(1.0f);
+    float dummy2;
 };
 
 // 주로 Pixel 쉐이더에서 사용
@@ -4,6 +4,7 @@
 
 #include <DirectXTexEXR.h> // EXR 형식 HDRI 읽기
 #include <algorithm>
+#include <chrono>
 #include <directxtk/DDSTextureLoader.h> // 큐브맵 읽을 때 필요
 #include <dxgi.h>                       // DXGIFactory
 #include <dxgi1_4.h>                    // DXGIFactory4
@@ -39,7 +40,8 @@ void D3D11Utils::CreateVertexShaderAndInputLayout(
     ComPtr<ID3D11Device> &device, const wstring &filename,
     const vector<D3D11_INPUT_ELEMENT_DESC> &inputElements,
     ComPtr<ID3D11VertexShader> &m_vertexShader,
-    ComPtr<ID3D11InputLayout> &m_inputLayout) {
+    ComPtr<ID3D11InputLayout> &m_inputLayout,
+    const D3D_SHADER_MACRO *defines) {
 
     ComPtr<ID3DBlob> shaderBlob;
     ComPtr<ID3DBlob> errorBlob;
@@ -52,7 +54,7 @@ void D3D11Utils::CreateVertexShaderAndInputLayout(
     // 쉐이더의 시작점의 이름이 "main"인 함수로 지정
     // D3D_COMPILE_STANDARD_FILE_INCLUDE 추가: 쉐이더에서 include 사용
     HRESULT hr = D3DCompileFromFile(
-        filename.c_str(), 0, D3D_COMPILE_STANDARD_FILE_INCLUDE, "main",
+        filename.c_str(), defines, D3D_COMPILE_STANDARD_FILE_INCLUDE, "main",
         "vs_5_0", compileFlags, 0, &shaderBlob, &errorBlob);
 
     CheckResult(hr, errorBlob.Get());
@@ -221,18 +223,32 @@ void ReadEXRImage(const std::string filename, std::vector<uint8_t> &image,
     // }
 }
 
+// file: 이미 매핑해둔 파일이 있으면 디스크에서 다시 읽지 않고 그대로 디코딩
 void ReadImage(const std::string filename, std::vector<uint8_t> &image,
-               int &width, int &height) {
+               int &width, int &height, double *decodeMs = nullptr,
+               double *convertMs = nullptr,
+               const MappedFile *file = nullptr) {
 
     int channels;
 
+    auto startTime = chrono::steady_clock::now();
+
     unsigned char *img =
-        stbi_load(filename.c_str(), &width, &height, &channels, 0);
+        file && file->IsOpen()
+            ? stbi_load_from_memory(file->Data(), int(file->Size()), &width,
+                                    &height, &channels, 0)
+            : stbi_load(filename.c_str(), &width, &height, &channels, 0);
 
-    // assert(channels == 4);
+    auto decodedTime = chrono::steady_clock::now();
+
+    if (!img) {
+        cout << "Failed to read " << filename << endl;
+        width = height = 0;
+        image.clear();
+        return;
+    }
 
-    cout << filename << " " << width << " " << height << " " << channels
-         << endl;
+    // assert(channels == 4);
 
     // 4채널로 만들어서 복사
     image.resize(width * height * 4);
@@ -269,7 +285,19 @@ void ReadImage(const std::string filename, std::vector<uint8_t> &image,
         std::cout << "Cannot read " << channels << " channels" << endl;
     }
 
-    delete[] img;
+    stbi_image_free(img); // stbi_load()는 malloc()으로 할당
+
+    auto convertedTime = chrono::steady_clock::now();
+
+    if (decodeMs) {
+        *decodeMs += chrono::duration<double, milli>(decodedTime - startTime)
+                         .count();
+    }
+    if (convertMs) {
+        *convertMs +=
+            chrono::duration<double, milli>(convertedTime - decodedTime)
+                .count();
+    }
 }
 
 ComPtr<ID3D11Texture2D>
@@ -360,14 +388,14 @@ void CreateTextureHelper(ComPtr<ID3D11Device> &device,
     // HLSL 쉐이더 안에서는 SampleLevel() 사용
 }
 
-void D3D11Utils::CreateMetallicRoughnessTexture(
-    ComPtr<ID3D11Device> &device, ComPtr<ID3D11DeviceContext> &context,
+void D3D11Utils::DecodeMetallicRoughnessTexture(
     const std::string metallicFilename, const std::string roughnessFilename,
-    ComPtr<ID3D11Texture2D> &texture, ComPtr<ID3D11ShaderResourceView> &srv) {
+    TextureImage &texImage, const MappedFile *metallicFile,
+    const MappedFile *roughnessFile) {
 
     // GLTF 방식은 이미 합쳐져 있음
     if (!metallicFilename.empty() && (metallicFilename == roughnessFilename)) {
-        CreateTexture(device, context, metallicFilename, false, texture, srv);
+        DecodeTexture(metallicFilename, false, texImage, metallicFile);
     } else {
         // 별도 파일일 경우 따로 읽어서 합쳐줍니다.
 
@@ -381,11 +409,13 @@ void D3D11Utils::CreateMetallicRoughnessTexture(
         // (거의 없겠지만) 둘 중 하나만 있을 경우도 고려하기 위해 각각 파일명
         // 확인
         if (!metallicFilename.empty()) {
-            ReadImage(metallicFilename, mImage, mWidth, mHeight);
+            ReadImage(metallicFilename, mImage, mWidth, mHeight,
+                      &texImage.decodeMs, &texImage.convertMs, metallicFile);
         }
 
         if (!roughnessFilename.empty()) {
-            ReadImage(roughnessFilename, rImage, rWidth, rHeight);
+            ReadImage(roughnessFilename, rImage, rWidth, rHeight,
+                      &texImage.decodeMs, &texImage.convertMs, roughnessFile);
         }
 
         // 두 이미지의 해상도가 같다고 가정
@@ -394,43 +424,90 @@ void D3D11Utils::CreateMetallicRoughnessTexture(
             assert(mHeight == rHeight);
         }
 
-        vector<uint8_t> combinedImage(size_t(mWidth * mHeight) * 4);
-        fill(combinedImage.begin(), combinedImage.end(), 0);
+        // 둘 중 하나만 있을 경우 그 해상도 사용
+        const int width = mImage.empty() ? rWidth : mWidth;
+        const int height = mImage.empty() ? rHeight : mHeight;
+
+        auto startTime = chrono::steady_clock::now();
 
-        for (size_t i = 0; i < size_t(mWidth * mHeight); i++) {
+        vector<uint8_t> &combinedImage = texImage.image;
+        combinedImage.assign(size_t(width * height) * 4, 0);
+
+        for (size_t i = 0; i < size_t(width * height); i++) {
             if (rImage.size())
                 combinedImage[4 * i + 1] = rImage[4 * i]; // Green = Roughness
             if (mImage.size())
                 combinedImage[4 * i + 2] = mImage[4 * i]; // Blue = Metalness
         }
 
-        CreateTextureHelper(device, context, mWidth, mHeight, combinedImage,
-                            DXGI_FORMAT_R8G8B8A8_UNORM, texture, srv);
+        texImage.convertMs += chrono::duration<double, milli>(
+                                  chrono::steady_clock::now() - startTime)
+                                  .count();
+
+        texImage.width = width;
+        texImage.height = height;
+        texImage.pixelFormat = DXGI_FORMAT_R8G8B8A8_UNORM;
     }
 }
 
-void D3D11Utils::CreateTexture(ComPtr<ID3D11Device> &device,
-                               ComPtr<ID3D11DeviceContext> &context,
-                               const std::string filename, const bool usSRGB,
-                               ComPtr<ID3D11Texture2D> &tex,
-                               ComPtr<ID3D11ShaderResourceView> &srv) {
+void D3D11Utils::CreateMetallicRoughnessTexture(
+    ComPtr<ID3D11Device> &device, ComPtr<ID3D11DeviceContext> &context,
+    const std::string metallicFilename, const std::string roughnessFilename,
+    ComPtr<ID3D11Texture2D> &texture, ComPtr<ID3D11ShaderResourceView> &srv) {
 
-    int width = 0, height = 0;
-    std::vector<uint8_t> image;
-    DXGI_FORMAT pixelFormat =
+    TextureImage texImage;
+    DecodeMetallicRoughnessTexture(metallicFilename, roughnessFilename,
+                                   texImage);
+    UploadTexture(device, context, texImage, texture, srv);
+}
+
+void D3D11Utils::DecodeTexture(const std::string filename, const bool usSRGB,
+                               TextureImage &texImage,
+                               const MappedFile *file) {
+
+    texImage.pixelFormat =
         usSRGB ? DXGI_FORMAT_R8G8B8A8_UNORM_SRGB : DXGI_FORMAT_R8G8B8A8_UNORM;
 
     string ext(filename.end() - 3, filename.end());
     std::transform(ext.begin(), ext.end(), ext.begin(), std::tolower);
 
+    // DirectXTex는 EXR을 파일에서만 읽으므로 file은 사용하지 않음
     if (ext == "exr") {
-        ReadEXRImage(filename, image, width, height, pixelFormat);
+        auto startTime = chrono::steady_clock::now();
+        ReadEXRImage(filename, texImage.image, texImage.width, texImage.height,
+                     texImage.pixelFormat);
+        texImage.decodeMs += chrono::duration<double, milli>(
+                                 chrono::steady_clock::now() - startTime)
+                                 .count();
     } else {
-        ReadImage(filename, image, width, height);
+        ReadImage(filename, texImage.image, texImage.width, texImage.height,
+                  &texImage.decodeMs, &texImage.convertMs, file);
+    }
+}
+
+void D3D11Utils::UploadTexture(ComPtr<ID3D11Device> &device,
+                               ComPtr<ID3D11DeviceContext> &context,
+                               const TextureImage &texImage,
+                               ComPtr<ID3D11Texture2D> &tex,
+                               ComPtr<ID3D11ShaderResourceView> &srv) {
+
+    if (texImage.image.empty()) {
+        return; // 읽기 실패
     }
 
-    CreateTextureHelper(device, context, width, height, image, pixelFormat, tex,
-                        srv);
+    CreateTextureHelper(device, context, texImage.width, texImage.height,
+                        texImage.image, texImage.pixelFormat, tex, srv);
+}
+
+void D3D11Utils::CreateTexture(ComPtr<ID3D11Device> &device,
+                               ComPtr<ID3D11DeviceContext> &context,
+                               const std::string filename, const bool usSRGB,
+                               ComPtr<ID3D11Texture2D> &tex,
+                               ComPtr<ID3D11ShaderResourceView> &srv) {
+
+    TextureImage texImage;
+    DecodeTexture(filename, usSRGB, texImage);
+    UploadTexture(device, context, texImage, tex, srv);
 }
 
 void D3D11Utils::CreateTextureArray(
@@ -9,6 +9,8 @@
 #include <windows.h>
 #include <wrl/client.h> // ComPtr
 
+#include "MappedFile.h"
+
 // AppBase와 ExampleApp을 정리하기 위해
 // 반복해서 사용되는 쉐이더 생성, 버퍼 생성 등을 분리
 
@@ -26,13 +28,27 @@ inline void ThrowIfFailed(HRESULT hr) {
     }
 }
 
+// 디코딩과 변환까지 끝난 CPU 이미지 (GPU 업로드 전)
+// 디코딩은 여러 스레드에서 동시에 하고 업로드만 메인 스레드에서 하기 위해 분리
+struct TextureImage {
+    std::vector<uint8_t> image;
+    int width = 0;
+    int height = 0;
+    DXGI_FORMAT pixelFormat = DXGI_FORMAT_R8G8B8A8_UNORM;
+
+    double decodeMs = 0.0;  // 파일 읽기 + 압축 해제
+    double convertMs = 0.0; // 4채널 변환, metallic/roughness 합치기
+};
+
 class D3D11Utils {
   public:
+    // defines: 같은 파일을 다른 매크로로 컴파일할 때 사용 (nullptr로 끝남)
     static void CreateVertexShaderAndInputLayout(
         ComPtr<ID3D11Device> &device, const wstring &filename,
         const vector<D3D11_INPUT_ELEMENT_DESC> &inputElements,
         ComPtr<ID3D11VertexShader> &m_vertexShader,
-        ComPtr<ID3D11InputLayout> &m_inputLayout);
+        ComPtr<ID3D11InputLayout> &m_inputLayout,
+        const D3D_SHADER_MACRO *defines = nullptr);
 
     static void CreateHullShader(ComPtr<ID3D11Device> &device,
                                  const wstring &filename,
@@ -131,6 +147,24 @@ class D3D11Utils {
                   ComPtr<ID3D11Texture2D> &texture,
                   ComPtr<ID3D11ShaderResourceView> &textureResourceView);
 
+    // 디바이스를 사용하지 않으므로 작업 스레드에서 호출 가능
+    // file: 해시 계산 등으로 이미 매핑해둔 파일 (없으면 filename에서 읽음)
+    static void DecodeTexture(const std::string filename, const bool usSRGB,
+                              TextureImage &texImage,
+                              const MappedFile *file = nullptr);
+
+    static void DecodeMetallicRoughnessTexture(
+        const std::string metallicFilename,
+        const std::string roughnessFilename, TextureImage &texImage,
+        const MappedFile *metallicFile = nullptr,
+        const MappedFile *roughnessFile = nullptr);
+
+    static void UploadTexture(ComPtr<ID3D11Device> &device,
+                              ComPtr<ID3D11DeviceContext> &context,
+                              const TextureImage &texImage,
+                              ComPtr<ID3D11Texture2D> &texture,
+                              ComPtr<ID3D11ShaderResourceView> &srv);
+
     static void CreateMetallicRoughnessTexture(
         ComPtr<ID3D11Device> &device, ComPtr<ID3D11DeviceContext> &context,
         const std::string metallicFiilename,
@@ -7,10 +7,23 @@ cbuffer MeshConstants : register(b0)
     int useHeightMap;
     float heightScale;
     float2 dummy;
+    float3 positionMin;    // PackedVertex의 위치 복원
+    float dummy1;
+    float3 positionExtent;
+    float dummy2;
 };
 
+#ifdef PACKED_VERTEX
+float4 main(PackedVertexShaderInput packedInput) : SV_POSITION
+#else
 float4 main(VertexShaderInput input) : SV_POSITION
+#endif
 {
+#ifdef PACKED_VERTEX
+    VertexShaderInput input =
+        UnpackVertex(packedInput, positionMin, positionExtent);
+#endif
+
     float4 pos = mul(float4(input.posModel, 1.0f), world);
     return mul(pos, viewProj);
 }
@@ -1,13 +1,18 @@
 #include "ExampleApp.h"
 
 #include <DirectXCollision.h> // 구와 광선 충돌 계산에 사용
+#include <cfloat>
 #include <directxtk/DDSTextureLoader.h>
 #include <directxtk/SimpleMath.h>
+#include <filesystem>
+#include <numeric>
 #include <tuple>
 #include <vector>
 
 #include "GeometryGenerator.h"
+#include "GeometryRegistry.h"
 #include "GraphicsCommon.h"
+#include "MeshOptimizer.h"
 
 namespace Moon {
 
@@ -33,9 +38,11 @@ bool ExampleApp::Initialize() {
 
     // 후처리용 화면 사각형
     {
-        auto meshData = GeometryGenerator::MakeSquare();
-        m_screenSquare =
-            make_shared<Model>(m_device, m_context, vector{meshData});
+        // PostProcess의 사각형과 같은 지오메트리
+        auto square = GeometryRegistry::Get().GetOrCreate(
+            m_device, GeometryRegistry::MakeKey("MakeSquare", {1.0f}),
+            [] { return GeometryGenerator::MakeSquare(); });
+        m_screenSquare = make_shared<Model>(m_device, square);
     }
 
     // 환경 박스 초기화
@@ -66,13 +73,49 @@ bool ExampleApp::Initialize() {
         // m_basicList.push_back(m_ground); // 거울은 리스트에 등록 X
     }
 
+    // 지형 (바닥 아래에 넓게 펼침, GUI에서 켜기)
+    // 높이맵 이미지가 있으면 사용하고 없으면 사인파 언덕으로 대신함
+    {
+        HeightFunction heightFunction = [](float x, float z) {
+            return -3.0f + 1.5f * sinf(x * 0.05f) * cosf(z * 0.04f) +
+                   0.3f * sinf(x * 0.23f + z * 0.17f);
+        };
+
+        const string heightMapFilename =
+            "../Assets/Textures/Terrain/HeightMap.png";
+        auto heightMap = make_shared<HeightMap>();
+        if (filesystem::exists(heightMapFilename) &&
+            heightMap->Load(heightMapFilename, 512.0f, 6.0f)) {
+            heightFunction = [heightMap](float x, float z) {
+                return heightMap->Sample(x, z) - 8.0f; // 바닥보다 아래로
+            };
+        } else {
+            cout << "Terrain: " << heightMapFilename
+                 << " not available, using procedural heights" << endl;
+        }
+
+        m_terrain = make_shared<Terrain>();
+        m_terrain->Initialize(m_device, m_context, heightFunction);
+        m_terrain->m_model->m_materialConstsCPU.albedoFactor =
+            Vector3(0.3f, 0.45f, 0.2f);
+        m_terrain->m_model->m_materialConstsCPU.metallicFactor = 0.0f;
+        m_terrain->m_model->m_materialConstsCPU.roughnessFactor = 0.9f;
+        m_terrain->m_model->m_isVisible = m_useTerrain;
+
+        m_basicList.push_back(m_terrain->m_model); // 리스트에 등록
+    }
+
     // Main Object
     {
         auto meshes = GeometryGenerator::ReadFromFile(
             "../Assets/Models/DamagedHelmet/", "DamagedHelmet.gltf");
 
         Vector3 center(0.0f, 0.4f, 2.0f);
-        m_mainObj = make_shared<Model>(m_device, m_context, meshes);
+        m_mainObj = make_shared<Model>();
+        m_mainObj->m_usePackedVertices = m_usePackedVertices;
+        m_mainObj->m_buildTriangleBVH = true; // 삼각형 단위로 피킹
+        m_mainObj->m_buildOccluder = true;
+        m_mainObj->Initialize(m_device, m_context, meshes);
         m_mainObj->m_materialConstsCPU.invertNormalMapY = true; // GLTF는 true로
         m_mainObj->m_materialConstsCPU.albedoFactor = Vector3(1.0f);
         m_mainObj->m_materialConstsCPU.roughnessFactor = 1.0f;
@@ -80,9 +123,6 @@ bool ExampleApp::Initialize() {
         m_mainObj->UpdateWorldRow(Matrix::CreateTranslation(center));
 
         m_basicList.push_back(m_mainObj); // 리스트에 등록
-
-        // 동일한 크기와 위치에 BoundingSphere 만들기
-        m_mainBoundingSphere = BoundingSphere(center, 0.4f);
     }
 
     // 조명 설정
@@ -104,12 +144,26 @@ bool ExampleApp::Initialize() {
         m_globalConstsCPU.lights[2].type = LIGHT_OFF;
     }
 
+    // 조명과 커서 표시에 쓰는 작은 구 (모두 같은 버퍼를 공유)
+    // 최적화와 LOD도 키에 넣어서 그냥 MakeSphere()한 구와 섞이지 않게 함
+    auto markerSphere = [&]() {
+        const LodOptions lodOptions;
+        const string key =
+            GeometryRegistry::MakeKey("MakeSphere", {0.01f, 10, 10}) +
+            GeometryRegistry::MakeKey("Optimize", {}) +
+            GeometryRegistry::MakeKey("GenerateLods", lodOptions.ratios);
+        return GeometryRegistry::Get().GetOrCreate(m_device, key, [&] {
+            MeshData sphere = GeometryGenerator::MakeSphere<10, 10>(0.01f);
+            MeshOptimizer::Optimize(sphere);
+            MeshSimplifier::GenerateLods(sphere, lodOptions);
+            return sphere;
+        });
+    };
+
     // 조명 위치 표시
     {
         for (int i = 0; i < MAX_LIGHTS; i++) {
-            MeshData sphere = GeometryGenerator::MakeSphere(0.01f, 10, 10);
-            m_lightSphere[i] =
-                make_shared<Model>(m_device, m_context, vector{sphere});
+            m_lightSphere[i] = make_shared<Model>(m_device, markerSphere());
             m_lightSphere[i]->UpdateWorldRow(Matrix::CreateTranslation(
                 m_globalConstsCPU.lights[i].position));
             m_lightSphere[i]->m_materialConstsCPU.albedoFactor = Vector3(0.0f);
@@ -125,9 +179,7 @@ bool ExampleApp::Initialize() {
 
     // 커서 표시 (Main sphere와의 충돌이 감지되면 월드 공간에 작게 그려지는 구)
     {
-        MeshData sphere = GeometryGenerator::MakeSphere(0.01f, 10, 10);
-        m_cursorSphere =
-            make_shared<Model>(m_device, m_context, vector{sphere});
+        m_cursorSphere = make_shared<Model>(m_device, markerSphere());
         m_cursorSphere->m_isVisible = false; // 마우스가 눌렸을 때만 보임
         m_cursorSphere->m_materialConstsCPU.albedoFactor = Vector3(0.0f);
         m_cursorSphere->m_materialConstsCPU.emissionFactor =
@@ -175,19 +227,30 @@ void ExampleApp::Update(float dt) {
 
     // 마우스 이동/회전 반영
     if (m_leftButton || m_rightButton) {
+        // 드래그를 시작할 때 커서 아래의 물체를 고름
+        if (m_dragStartFlag) {
+            m_pickedModel = PickModel();
+        }
+
+        // 마우스 선택에는 메쉬에서 계산한 월드 공간 바운딩 스피어 사용
         Quaternion q;
         Vector3 dragTranslation;
         Vector3 pickPoint;
-        if (UpdateMouseControl(m_mainBoundingSphere, q, dragTranslation,
-                               pickPoint)) {
-            Vector3 translation = m_mainObj->m_worldRow.Translation();
-            m_mainObj->m_worldRow.Translation(Vector3(0.0f));
-            m_mainObj->UpdateWorldRow(
-                m_mainObj->m_worldRow * Matrix::CreateFromQuaternion(q) *
+        if (m_pickedModel &&
+            UpdateMouseControl(m_pickedModel->m_worldBounds.sphere, q,
+                               dragTranslation, pickPoint)) {
+            Matrix worldRow = m_pickedModel->m_worldRow;
+            Vector3 translation = worldRow.Translation();
+            worldRow.Translation(Vector3(0.0f));
+            m_pickedModel->UpdateWorldRow(
+                worldRow * Matrix::CreateFromQuaternion(q) *
                 Matrix::CreateTranslation(dragTranslation + translation));
-            m_mainBoundingSphere.Center = m_mainObj->m_worldRow.Translation();
 
-            // 충돌 지점에 작은 구 그리기
+            // 충돌 지점에 작은 구 그리기 (삼각형 BVH가 있으면 메쉬 표면)
+            TriangleHit hit;
+            if (m_pickedModel->RayCast(GetCursorRay(), hit)) {
+                pickPoint = hit.point;
+            }
             m_cursorSphere->m_isVisible = true;
             m_cursorSphere->UpdateWorldRow(
                 Matrix::CreateTranslation(pickPoint));
@@ -195,14 +258,253 @@ void ExampleApp::Update(float dt) {
             m_cursorSphere->m_isVisible = false;
         }
     } else {
+        m_pickedModel.reset();
         m_cursorSphere->m_isVisible = false;
     }
 
+    // 카메라 주변의 지형 청크 생성/해제
+    m_terrain->m_model->m_isVisible = m_useTerrain;
+    if (m_useTerrain) {
+        m_terrain->Update(m_device, eyeWorld);
+    }
+
+    // 카메라와 반사된 카메라의 절두체 안에 있는 물체만 그림
+    if (m_useSceneBVH) {
+        UpdateSceneBVH();
+    } else {
+        m_frustumCuller.Clear();
+        for (const auto &i : m_basicList) {
+            if (i->m_worldBounds.isValid) {
+                m_frustumCuller.Add(i->m_worldBounds.aabb);
+            } else {
+                m_frustumCuller.AddAlwaysVisible();
+            }
+        }
+    }
+    if (m_useFrustumCulling) {
+        Vector4 planes[6];
+        m_camera.GetFrustumPlanes(planes);
+        CullObjects(planes, m_visibleList);
+    } else {
+        m_visibleList.resize(m_basicList.size());
+        std::iota(m_visibleList.begin(), m_visibleList.end(), 0);
+    }
+
+    // 거울이 화면에 보일 때만 거울 영역 안에 비치는 물체들을 그림
+    if (m_useReflectionCulling) {
+        m_reflectionView = ReflectionCuller::Compute(
+            m_mirror->m_worldBounds.aabb, m_mirrorPlane, eyeWorld, viewRow,
+            projRow, m_screenWidth, m_screenHeight);
+    } else {
+        m_reflectionView = ReflectionView();
+        m_reflectionView.isVisible = true;
+        m_reflectionView.scissor = {0, 0, LONG(m_screenWidth),
+                                    LONG(m_screenHeight)};
+        Camera::ExtractFrustumPlanes(reflectRow * viewRow * projRow,
+                                     m_reflectionView.planes);
+    }
+    if (!m_reflectionView.isVisible) {
+        m_reflectedVisibleList.clear();
+    } else if (m_useFrustumCulling || m_useReflectionCulling) {
+        CullObjects(m_reflectionView.planes, m_reflectedVisibleList);
+    } else {
+        m_reflectedVisibleList = m_visibleList;
+    }
+
+    // 절두체 안에 남은 물체 중에서 큰 물체 뒤에 가려진 것들을 제외
+    m_numOccluded = 0;
+    m_numReflectedOccluded = 0;
+    if (m_useOcclusionCulling) {
+        m_numOccluded =
+            CullOccluded(viewRow * projRow, eyeWorld, m_visibleList);
+        m_numReflectedOccluded = CullOccluded(
+            reflectRow * viewRow * projRow,
+            Vector3::Transform(eyeWorld, reflectRow), m_reflectedVisibleList);
+    }
+
+    // 화면에 보이는 크기에 따라 LOD 선택
+    for (auto &i : m_basicList) {
+        if (m_useLod) {
+            i->UpdateLod(eyeWorld, projRow);
+        } else {
+            i->m_lodLevel = 0;
+        }
+    }
+
+    // 카메라에 보이는 Meshlet만 남김 (LOD 선택 후)
+    const Matrix viewProjRow = viewRow * projRow;
+    for (const uint32_t i : m_visibleList) {
+        m_basicList[i]->m_useMeshletCulling = m_useMeshletCulling;
+        m_basicList[i]->CullMeshlets(eyeWorld, viewProjRow);
+    }
+
     for (auto &i : m_basicList) {
         i->UpdateConstantBuffers(m_device, m_context);
     }
 }
 
+void ExampleApp::UpdateSceneBVH() {
+
+    // 바운드가 없는 물체(예: 청크가 없는 지형)는 자리만 채우는 빈 상자로
+    // 넣고 FrustumCuller::AddAlwaysVisible()처럼 CullObjects()에서 항상 추가
+    auto boxOf = [](const Model &model) {
+        return model.m_worldBounds.isValid
+                   ? model.m_worldBounds.aabb
+                   : BoundingBox(Vector3(0.0f), Vector3(0.0f));
+    };
+
+    m_unboundedIds.clear();
+    for (uint32_t i = 0; i < uint32_t(m_basicList.size()); i++) {
+        if (!m_basicList[i]->m_worldBounds.isValid) {
+            m_unboundedIds.push_back(i);
+        }
+    }
+
+    bool rebuild = m_sceneBVH.Size() != m_basicList.size();
+    if (!rebuild) {
+        for (uint32_t i = 0; i < uint32_t(m_basicList.size()); i++) {
+            const Model &model = *m_basicList[i];
+            if (m_bvhVersions[i] != model.m_worldBoundsVersion) {
+                m_bvhVersions[i] = model.m_worldBoundsVersion;
+                m_sceneBVH.Update(i, boxOf(model));
+            }
+        }
+        rebuild = m_sceneBVH.NeedsRebuild();
+    }
+
+    if (rebuild) {
+        vector<BoundingBox> boxes(m_basicList.size());
+        m_bvhVersions.resize(m_basicList.size());
+        for (size_t i = 0; i < m_basicList.size(); i++) {
+            boxes[i] = boxOf(*m_basicList[i]);
+            m_bvhVersions[i] = m_basicList[i]->m_worldBoundsVersion;
+        }
+        m_sceneBVH.Build(boxes);
+    }
+}
+
+shared_ptr<Model> ExampleApp::PickModel() {
+
+    const Ray ray = GetCursorRay();
+
+    // 삼각형 BVH가 있으면 메쉬와 직접, 없으면 바운딩 스피어로 선택
+    auto intersect = [&](uint32_t id, float &distance) {
+        const auto &model = m_basicList[id];
+        if (!model->m_isVisible || model == m_cursorSphere ||
+            model == m_terrain->m_model) {
+            return false;
+        }
+        for (const auto &light : m_lightSphere) {
+            if (model == light) {
+                return false;
+            }
+        }
+        if (model->m_triangleBVH) {
+            TriangleHit hit;
+            if (!model->RayCast(ray, hit)) {
+                return false;
+            }
+            distance = hit.distance;
+            return true;
+        }
+        return model->m_worldBounds.isValid &&
+               ray.Intersects(model->m_worldBounds.sphere, distance);
+    };
+
+    uint32_t id = 0;
+    float distance = 0.0f;
+    if (m_useSceneBVH) {
+        UpdateSceneBVH();
+        if (m_sceneBVH.RayCast(ray.position, ray.direction, id, distance,
+                               intersect)) {
+            return m_basicList[id];
+        }
+        return nullptr;
+    }
+
+    shared_ptr<Model> picked;
+    float minDistance = FLT_MAX;
+    for (uint32_t i = 0; i < uint32_t(m_basicList.size()); i++) {
+        if (intersect(i, distance) && distance < minDistance) {
+            minDistance = distance;
+            picked = m_basicList[i];
+        }
+    }
+    return picked;
+}
+
+void ExampleApp::CullObjects(const Vector4 planes[6],
+                             vector<uint32_t> &visibleList) {
+    if (m_useSceneBVH) {
+        m_sceneBVH.QueryFrustum(planes, visibleList);
+
+        // 빈 상자가 절두체에 걸려서 들어온 것은 빼고 모두 추가
+        visibleList.erase(remove_if(visibleList.begin(), visibleList.end(),
+                                    [&](uint32_t i) {
+                                        return !m_basicList[i]
+                                                    ->m_worldBounds.isValid;
+                                    }),
+                          visibleList.end());
+        visibleList.insert(visibleList.end(), m_unboundedIds.begin(),
+                           m_unboundedIds.end());
+    } else {
+        m_frustumCuller.Cull(planes, visibleList);
+    }
+}
+
+size_t ExampleApp::CullOccluded(const Matrix &viewProjRow,
+                                const Vector3 &eyeWorld,
+                                vector<uint32_t> &visibleList) {
+
+    const OcclusionOptions options;
+
+    // 화면 높이 대비 크기가 큰 순서로 가리는 물체 선택 (UpdateLod()와 같음)
+    const float projScale = m_camera.GetProjRow()._22;
+    vector<pair<float, uint32_t>> occluders;
+    for (const uint32_t i : visibleList) {
+        const Model &model = *m_basicList[i];
+        if (!model.m_occluder || !model.m_isVisible) {
+            continue;
+        }
+        const BoundingSphere &sphere = model.m_worldBounds.sphere;
+        const float distance = (Vector3(sphere.Center) - eyeWorld).Length();
+        const float screenSize = distance > sphere.Radius
+                                     ? sphere.Radius * projScale / distance
+                                     : FLT_MAX;
+        if (screenSize >= options.minOccluderSize) {
+            occluders.push_back({screenSize, i});
+        }
+    }
+    if (occluders.empty()) {
+        return 0;
+    }
+    std::sort(occluders.begin(), occluders.end(), std::greater<>());
+    if (occluders.size() > size_t(options.maxOccluders)) {
+        occluders.resize(options.maxOccluders);
+    }
+
+    m_occlusionCuller.Begin(viewProjRow, options);
+    for (const auto &occluder : occluders) {
+        const Model &model = *m_basicList[occluder.second];
+        m_occlusionCuller.AddOccluder(*model.m_occluder, model.m_worldRow);
+    }
+    m_occlusionCuller.Rasterize();
+
+    // 가리는 물체 자신과 바운드가 없는 물체는 그대로 둠
+    const size_t numVisible = visibleList.size();
+    visibleList.erase(
+        std::remove_if(visibleList.begin(), visibleList.end(),
+                       [&](uint32_t i) {
+                           const Model &model = *m_basicList[i];
+                           return !model.m_occluder &&
+                                  model.m_worldBounds.isValid &&
+                                  m_occlusionCuller.IsOccluded(
+                                      model.m_worldBounds.aabb);
+                       }),
+        visibleList.end());
+    return numVisible - visibleList.size();
+}
+
 void ExampleApp::Render() {
 
     AppBase::SetViewport();
@@ -235,8 +537,8 @@ void ExampleApp::Render() {
     AppBase::SetPipelineState(Graphics::defaultSolidPSO);
     AppBase::SetGlobalConsts(m_globalConstsGPU); // 비록 목적은 depthOnlyDSV만
                                                  // 변화시키는 거지만 렌더링필요
-    for (auto &i : m_basicList)
-        i->Render(m_context);
+    for (const uint32_t i : m_visibleList)
+        m_basicList[i]->Render(m_context);
     m_skybox->Render(m_context);
     m_mirror->Render(m_context);
 
@@ -253,14 +555,14 @@ void ExampleApp::Render() {
                                            : Graphics::defaultSolidPSO);
     AppBase::SetGlobalConsts(m_globalConstsGPU);
 
-    for (auto &i : m_basicList) {
-        i->Render(m_context);
+    for (const uint32_t i : m_visibleList) {
+        m_basicList[i]->Render(m_context);
     }
 
     AppBase::SetPipelineState(Graphics::normalsPSO);
-    for (auto &i : m_basicList) {
-        if (i->m_drawNormals)
-            i->RenderNormals(m_context);
+    for (const uint32_t i : m_visibleList) {
+        if (m_basicList[i]->m_drawNormals)
+            m_basicList[i]->RenderNormals(m_context);
     }
 
     AppBase::SetPipelineState(m_drawAsWire ? Graphics::skyboxWirePSO
@@ -268,6 +570,36 @@ void ExampleApp::Render() {
 
     m_skybox->Render(m_context);
 
+    // 거울이 화면 밖이거나 뒷면이면 반사 패스 전체를 건너뜀
+    if (m_reflectionView.isVisible) {
+        RenderMirror();
+    }
+
+    m_context->ResolveSubresource(m_resolvedBuffer.Get(), 0,
+                                  m_floatBuffer.Get(), 0,
+                                  DXGI_FORMAT_R16G16B16A16_FLOAT);
+
+    // PostEffects
+    AppBase::SetPipelineState(Graphics::postEffectsPSO);
+    vector<ID3D11ShaderResourceView *> postEffectsSRVs = {
+        m_resolvedSRV.Get(), m_depthOnlySRV.Get()}; // 20번에 넣어줌
+    m_context->PSSetShaderResources(20, UINT(postEffectsSRVs.size()),
+                                    postEffectsSRVs.data());
+    m_context->OMSetRenderTargets(1, m_postEffectsRTV.GetAddressOf(), NULL);
+    m_context->PSSetConstantBuffers(3, 1,
+                                    m_postEffectsConstsGPU.GetAddressOf());
+    m_screenSquare->Render(m_context);
+
+    // 단순 이미지 처리와 블룸
+    AppBase::SetPipelineState(Graphics::postProcessingPSO);
+    m_postProcess.Render(m_context);
+}
+
+void ExampleApp::RenderMirror() {
+
+    // 화면에서 거울이 차지하는 사각형 밖은 래스터화하지 않음
+    m_context->RSSetScissorRects(1, &m_reflectionView.scissor);
+
     // 거울 2. 거울 위치만 StencilBuffer에 1로 표기
     AppBase::SetPipelineState(Graphics::stencilMaskPSO);
 
@@ -281,8 +613,9 @@ void ExampleApp::Render() {
     m_context->ClearDepthStencilView(m_depthStencilView.Get(),
                                      D3D11_CLEAR_DEPTH, 1.0f, 0);
 
-    for (auto &i : m_basicList) {
-        i->Render(m_context);
+    // Meshlet 컬링은 카메라 기준이므로 반사된 시점에서는 사용하지 않음
+    for (const uint32_t i : m_reflectedVisibleList) {
+        m_basicList[i]->Render(m_context, false);
     }
 
     AppBase::SetPipelineState(m_drawAsWire ? Graphics::reflectSkyboxWirePSO
@@ -295,25 +628,6 @@ void ExampleApp::Render() {
     AppBase::SetGlobalConsts(m_globalConstsGPU);
 
     m_mirror->Render(m_context);
-
-    m_context->ResolveSubresource(m_resolvedBuffer.Get(), 0,
-                                  m_floatBuffer.Get(), 0,
-                                  DXGI_FORMAT_R16G16B16A16_FLOAT);
-
-    // PostEffects
-    AppBase::SetPipelineState(Graphics::postEffectsPSO);
-    vector<ID3D11ShaderResourceView *> postEffectsSRVs = {
-        m_resolvedSRV.Get(), m_depthOnlySRV.Get()}; // 20번에 넣어줌
-    m_context->PSSetShaderResources(20, UINT(postEffectsSRVs.size()),
-                                    postEffectsSRVs.data());
-    m_context->OMSetRenderTargets(1, m_postEffectsRTV.GetAddressOf(), NULL);
-    m_context->PSSetConstantBuffers(3, 1,
-                                    m_postEffectsConstsGPU.GetAddressOf());
-    m_screenSquare->Render(m_context);
-
-    // 단순 이미지 처리와 블룸
-    AppBase::SetPipelineState(Graphics::postProcessingPSO);
-    m_postProcess.Render(m_context);
 }
 
 void ExampleApp::UpdateGUI() {
@@ -322,6 +636,36 @@ void ExampleApp::UpdateGUI() {
     if (ImGui::TreeNode("General")) {
         ImGui::Checkbox("Use FPV", &m_camera.m_useFirstPersonView);
         ImGui::Checkbox("Wireframe", &m_drawAsWire);
+        ImGui::Checkbox("Use LOD", &m_useLod);
+        ImGui::Checkbox("Frustum Culling", &m_useFrustumCulling);
+        ImGui::Checkbox("Scene BVH", &m_useSceneBVH);
+        if (m_useFrustumCulling) {
+            ImGui::Text("Objects: %zu / %zu (reflection %zu)",
+                        m_visibleList.size(), m_basicList.size(),
+                        m_reflectedVisibleList.size());
+        }
+        ImGui::Checkbox("Occlusion Culling", &m_useOcclusionCulling);
+        if (m_useOcclusionCulling) {
+            ImGui::Text("Occluded: %zu (reflection %zu)", m_numOccluded,
+                        m_numReflectedOccluded);
+        }
+        ImGui::Checkbox("Meshlet Culling", &m_useMeshletCulling);
+        if (m_useMeshletCulling) {
+            size_t numMeshlets = 0, numVisible = 0;
+            for (const auto &i : m_basicList) {
+                numMeshlets += i->m_numMeshlets;
+            }
+            for (const uint32_t i : m_visibleList) {
+                numVisible += m_basicList[i]->m_numVisibleMeshlets;
+            }
+            ImGui::Text("Meshlets: %zu / %zu", numVisible, numMeshlets);
+        }
+        ImGui::Checkbox("Terrain", &m_useTerrain);
+        if (m_useTerrain) {
+            const auto stats = m_terrain->GetStats();
+            ImGui::Text("Chunks: %zu, Triangles: %zu, %zuMB", stats.numChunks,
+                        stats.numTriangles, stats.vertexBytes / (1024 * 1024));
+        }
         if (ImGui::Checkbox("MSAA ON", &m_useMSAA)) {
             CreateBuffers();
         }
@@ -383,6 +727,15 @@ void ExampleApp::UpdateGUI() {
     ImGui::SetNextItemOpen(true, ImGuiCond_Once);
     if (ImGui::TreeNode("Mirror")) {
 
+        ImGui::Checkbox("Reflection Culling", &m_useReflectionCulling);
+        if (!m_reflectionView.isVisible) {
+            ImGui::Text("Off-screen");
+        } else {
+            const D3D11_RECT &r = m_reflectionView.scissor;
+            ImGui::Text("Scissor %ldx%ld, objects %zu", r.right - r.left,
+                        r.bottom - r.top, m_reflectedVisibleList.size());
+        }
+
         ImGui::SliderFloat("Alpha", &m_mirrorAlpha, 0.0f, 1.0f);
         const float blendColor[4] = {m_mirrorAlpha, m_mirrorAlpha,
                                      m_mirrorAlpha, 1.0f};
@@ -6,9 +6,15 @@
 #include <memory>
 
 #include "AppBase.h"
+#include "FrustumCuller.h"
 #include "GeometryGenerator.h"
 #include "ImageFilter.h"
+#include "MeshSimplifier.h"
 #include "Model.h"
+#include "OcclusionCuller.h"
+#include "ReflectionCuller.h"
+#include "SceneBVH.h"
+#include "Terrain.h"
 
 namespace Moon {
 
@@ -25,24 +31,65 @@ class ExampleApp : public AppBase {
     virtual void Render() override;
 
   protected:
+    // 거울 위치에 반사된 장면을 그리고 거울 재질을 섞음 (m_reflectionView 사용)
+    void RenderMirror();
+
+    // m_basicList의 월드 바운드를 m_sceneBVH에 반영 (움직인 물체만 refit)
+    void UpdateSceneBVH();
+
+    // 커서 광선과 만나는 가장 가까운 물체 (조명/커서 표시, 지형은 제외)
+    shared_ptr<Model> PickModel();
+
+    // m_basicList 중에서 planes 안에 있는 물체들의 인덱스
+    void CullObjects(const Vector4 planes[6], vector<uint32_t> &visibleList);
+
+    // 화면에서 큰 가리는 물체들을 CPU에서 그리고 그 뒤에 가려진 물체를 제거
+    // 제거한 개수를 반환
+    size_t CullOccluded(const Matrix &viewProjRow, const Vector3 &eyeWorld,
+                        vector<uint32_t> &visibleList);
+
     shared_ptr<Model> m_ground;
     shared_ptr<Model> m_mainObj;
     shared_ptr<Model> m_lightSphere[MAX_LIGHTS];
     shared_ptr<Model> m_skybox;
     shared_ptr<Model> m_cursorSphere;
     shared_ptr<Model> m_screenSquare;
+    shared_ptr<Terrain> m_terrain;
 
-    BoundingSphere m_mainBoundingSphere;
+    shared_ptr<Model> m_pickedModel; // 마우스로 드래그 중인 물체
 
     bool m_usePerspectiveProjection = true;
+    bool m_useLod = true;
+    bool m_useMeshletCulling = true;
+    bool m_usePackedVertices = true; // 메인 오브젝트 초기화 때만 적용
+    bool m_useTerrain = false;
+    bool m_useFrustumCulling = true;
+    bool m_useSceneBVH = true; // 절두체 컬링과 피킹에 m_sceneBVH 사용
+    bool m_useOcclusionCulling = true;
+    bool m_useReflectionCulling = true; // 거울 영역으로 반사 패스 제한
 
     // 거울
     shared_ptr<Model> m_mirror;
     DirectX::SimpleMath::Plane m_mirrorPlane;
     float m_mirrorAlpha = 1.0f; // Opacity
+    ReflectionView m_reflectionView;
 
     // 거울이 아닌 물체들의 리스트 (for문으로 그리기 위함)
     vector<shared_ptr<Model>> m_basicList;
+
+    // m_basicList 중에서 절두체 안에 있는 물체들의 인덱스 (매 프레임 갱신)
+    FrustumCuller m_frustumCuller;
+    vector<uint32_t> m_visibleList;          // 카메라 (Depth Only, 메인)
+    vector<uint32_t> m_reflectedVisibleList; // 거울에 반사된 시점
+
+    // m_basicList의 인덱스를 id로 쓰는 BVH
+    SceneBVH m_sceneBVH;
+    vector<uint32_t> m_bvhVersions; // 물체별 m_worldBoundsVersion
+    vector<uint32_t> m_unboundedIds; // 바운드가 없어서 컬링하지 않는 물체들
+
+    OcclusionCuller m_occlusionCuller; // 카메라와 거울 시점에서 차례로 사용
+    size_t m_numOccluded = 0;
+    size_t m_numReflectedOccluded = 0;
 };
 
 } // namespace hlab
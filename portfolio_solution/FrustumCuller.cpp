@@ -0,0 +1,111 @@
+#include "FrustumCuller.h"
+
+#include <cfloat>
+
+namespace Moon {
+
+using namespace std;
+using namespace DirectX;
+
+void FrustumCuller::Clear() {
+    m_centerX.clear();
+    m_centerY.clear();
+    m_centerZ.clear();
+    m_extentX.clear();
+    m_extentY.clear();
+    m_extentZ.clear();
+    m_numBoxes = 0;
+}
+
+void FrustumCuller::Reserve(size_t numBoxes) {
+    const size_t padded = (numBoxes + 3) / 4 * 4;
+    for (auto *v : {&m_centerX, &m_centerY, &m_centerZ, &m_extentX,
+                    &m_extentY, &m_extentZ}) {
+        v->reserve(padded);
+    }
+}
+
+void FrustumCuller::Add(const BoundingBox &box) {
+
+    // 새로운 4개 묶음이 필요하면 미리 늘려둠
+    if (m_numBoxes % 4 == 0) {
+        for (auto *v : {&m_centerX, &m_centerY, &m_centerZ, &m_extentX,
+                        &m_extentY, &m_extentZ}) {
+            v->resize(m_numBoxes + 4, 0.0f);
+        }
+    }
+
+    m_centerX[m_numBoxes] = box.Center.x;
+    m_centerY[m_numBoxes] = box.Center.y;
+    m_centerZ[m_numBoxes] = box.Center.z;
+    m_extentX[m_numBoxes] = box.Extents.x;
+    m_extentY[m_numBoxes] = box.Extents.y;
+    m_extentZ[m_numBoxes] = box.Extents.z;
+    m_numBoxes++;
+}
+
+void FrustumCuller::AddAlwaysVisible() {
+    // 원점에서 모든 평면을 넘는 상자
+    Add(BoundingBox(XMFLOAT3(0.0f, 0.0f, 0.0f),
+                    XMFLOAT3(FLT_MAX, FLT_MAX, FLT_MAX)));
+}
+
+size_t FrustumCuller::Cull(const Vector4 planes[6],
+                           vector<uint32_t> &visible) const {
+
+    // 분기 없이 쓰도록 최대 개수만큼 잡아 두고 마지막에 줄임
+    visible.resize(m_numBoxes + 4);
+    uint32_t *out = visible.data();
+    size_t numVisible = 0;
+
+    // 평면 성분을 4개씩 복제 (|n|은 투영된 반지름 계산용)
+    XMVECTOR nx[6], ny[6], nz[6], nw[6], ax[6], ay[6], az[6];
+    for (int p = 0; p < 6; p++) {
+        nx[p] = XMVectorReplicate(planes[p].x);
+        ny[p] = XMVectorReplicate(planes[p].y);
+        nz[p] = XMVectorReplicate(planes[p].z);
+        nw[p] = XMVectorReplicate(planes[p].w);
+        ax[p] = XMVectorAbs(nx[p]);
+        ay[p] = XMVectorAbs(ny[p]);
+        az[p] = XMVectorAbs(nz[p]);
+    }
+
+    for (size_t i = 0; i < m_numBoxes; i += 4) {
+        const XMVECTOR cx = XMLoadFloat4((const XMFLOAT4 *)&m_centerX[i]);
+        const XMVECTOR cy = XMLoadFloat4((const XMFLOAT4 *)&m_centerY[i]);
+        const XMVECTOR cz = XMLoadFloat4((const XMFLOAT4 *)&m_centerZ[i]);
+        const XMVECTOR ex = XMLoadFloat4((const XMFLOAT4 *)&m_extentX[i]);
+        const XMVECTOR ey = XMLoadFloat4((const XMFLOAT4 *)&m_extentY[i]);
+        const XMVECTOR ez = XMLoadFloat4((const XMFLOAT4 *)&m_extentZ[i]);
+
+        XMVECTOR outside = XMVectorFalseInt();
+        for (int p = 0; p < 6; p++) {
+            // distance + radius < 0 이면 평면 바깥
+            XMVECTOR distance = XMVectorMultiplyAdd(nx[p], cx, nw[p]);
+            distance = XMVectorMultiplyAdd(ny[p], cy, distance);
+            distance = XMVectorMultiplyAdd(nz[p], cz, distance);
+            XMVECTOR radius = XMVectorMultiply(ax[p], ex);
+            radius = XMVectorMultiplyAdd(ay[p], ey, radius);
+            radius = XMVectorMultiplyAdd(az[p], ez, radius);
+            outside = XMVectorOrInt(
+                outside, XMVectorLess(XMVectorAdd(distance, radius),
+                                      XMVectorZero()));
+        }
+
+        // 인덱스는 항상 쓰고 보이는 경우에만 개수를 늘림 (끝의 빈 칸은 밖으로)
+        int mask = _mm_movemask_ps(outside);
+        if (i + 4 > m_numBoxes) {
+            mask |= (0xf << (m_numBoxes - i)) & 0xf;
+        }
+        for (uint32_t k = 0; k < 4; k++) {
+            out[numVisible] = uint32_t(i) + k;
+            numVisible += ((mask >> k) & 1) ^ 1;
+        }
+    }
+
+    visible.resize(numVisible);
+
+    return visible.size();
+}
+
+} // namespace Moon
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <DirectXCollision.h>
+#include <directxtk/SimpleMath.h>
+#include <vector>
+
+namespace Moon {
+
+using DirectX::SimpleMath::Vector4;
+
+// 월드 공간 AABB 여러 개를 절두체 평면 6개와 한 번에 비교
+// 중심/반지름 성분별로 따로 모아 둔 배열(SoA)에서 4개씩 XMVECTOR로 읽어서
+// 평면마다 "중심까지 거리 < -투영된 반지름"이면 밖으로 판정
+// 참고: Fabian Giesen "View frustum culling"
+// https://fgiesen.wordpress.com/2010/10/17/view-frustum-culling/
+// 참고: Daniel Collin "Culling the Battlefield" (GDC 2011)
+
+class FrustumCuller {
+  public:
+    void Clear();
+    void Reserve(size_t numBoxes);
+
+    // 인덱스는 추가한 순서, 비어 있는 상자(isValid가 아닌 바운딩 볼륨 등)는
+    // 항상 보이도록 alwaysVisible로 추가
+    void Add(const DirectX::BoundingBox &box);
+    void AddAlwaysVisible();
+
+    size_t Size() const { return m_numBoxes; }
+
+    // 절두체 안에 있거나 걸친 상자들의 인덱스 (반환값은 개수)
+    // planes: Camera::ExtractFrustumPlanes()의 결과
+    size_t Cull(const Vector4 planes[6],
+                std::vector<uint32_t> &visible) const;
+
+  private:
+    // 4의 배수로 채움 (남는 칸은 Cull()에서 무시)
+    std::vector<float> m_centerX, m_centerY, m_centerZ;
+    std::vector<float> m_extentX, m_extentY, m_extentZ;
+    size_t m_numBoxes = 0;
+};
+
+} // namespace Moon
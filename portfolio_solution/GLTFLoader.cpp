@@ -0,0 +1,559 @@
+#include "GLTFLoader.h"
+
+// vcpkg install nlohmann-json:x64-windows
+#include <DirectXMath.h>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <nlohmann/json.hpp>
+
+#include "MappedFile.h"
+
+namespace Moon {
+
+using namespace std;
+using namespace DirectX;
+using namespace DirectX::SimpleMath;
+using nlohmann::json;
+
+namespace {
+
+// glTF 2.0 스펙에 정의된 상수들
+const int GLTF_UNSIGNED_BYTE = 5121;
+const int GLTF_UNSIGNED_SHORT = 5123;
+const int GLTF_UNSIGNED_INT = 5125;
+const int GLTF_FLOAT = 5126;
+const int GLTF_TRIANGLES = 4;
+
+const uint32_t GLB_MAGIC = 0x46546C67;      // "glTF"
+const uint32_t GLB_CHUNK_JSON = 0x4E4F534A; // "JSON"
+const uint32_t GLB_CHUNK_BIN = 0x004E4942;  // "BIN\0"
+
+struct BufferRange {
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+};
+
+// accessor 하나가 가리키는 메모리 (매핑된 파일 안을 직접 가리킴)
+struct AccessorView {
+    const uint8_t *data = nullptr;
+    size_t count = 0;
+    size_t stride = 0;
+    int componentType = 0;
+    int numComponents = 0;
+    bool normalized = false;
+
+    const uint8_t *Element(size_t i) const { return data + i * stride; }
+};
+
+// 파일에서 읽은 인덱스는 모두 json::at()으로 접근
+// (범위 밖이면 json::out_of_range가 나오고 Load()가 false를 반환)
+struct GLTFContext {
+    json doc;
+    string basePath;
+    vector<BufferRange> buffers;
+    vector<unique_ptr<MappedFile>> files; // buffers가 가리키는 메모리의 주인
+    vector<string> filenames;             // files의 경로
+    bool revertNormals = false;
+};
+
+size_t ComponentSize(int componentType) {
+    switch (componentType) {
+    case 5120: // BYTE
+    case GLTF_UNSIGNED_BYTE:
+        return 1;
+    case 5122: // SHORT
+    case GLTF_UNSIGNED_SHORT:
+        return 2;
+    case GLTF_UNSIGNED_INT:
+    case GLTF_FLOAT:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+int NumComponents(const string &type) {
+    if (type == "SCALAR")
+        return 1;
+    if (type == "VEC2")
+        return 2;
+    if (type == "VEC3")
+        return 3;
+    if (type == "VEC4")
+        return 4;
+    return 0; // 행렬 타입은 사용하지 않음
+}
+
+bool GetAccessor(const GLTFContext &ctx, int index, AccessorView &view) {
+
+    const json &accessors = ctx.doc.at("accessors");
+    if (index < 0 || index >= int(accessors.size())) {
+        return false;
+    }
+
+    const json &accessor = accessors.at(index);
+
+    // sparse accessor나 bufferView가 없는 경우(전부 0)는 Assimp에 맡김
+    if (accessor.contains("sparse") || !accessor.contains("bufferView")) {
+        return false;
+    }
+
+    const json &bufferView = ctx.doc.at("bufferViews")
+                                 .at(accessor.at("bufferView").get<size_t>());
+    const int bufferIndex = bufferView.value("buffer", 0);
+    if (bufferIndex < 0 || bufferIndex >= int(ctx.buffers.size())) {
+        return false;
+    }
+    const BufferRange &buffer = ctx.buffers[bufferIndex];
+
+    view.componentType = accessor.at("componentType").get<int>();
+    view.numComponents = NumComponents(accessor.at("type").get<string>());
+    view.count = accessor.at("count").get<size_t>();
+    view.normalized = accessor.value("normalized", false);
+
+    const size_t elementSize =
+        ComponentSize(view.componentType) * view.numComponents;
+    if (elementSize == 0) {
+        return false;
+    }
+
+    const size_t viewOffset = bufferView.value("byteOffset", size_t(0));
+    const size_t viewLength = bufferView.at("byteLength").get<size_t>();
+    const size_t accessorOffset = accessor.value("byteOffset", size_t(0));
+    view.stride = bufferView.value("byteStride", elementSize);
+    if (view.stride < elementSize) {
+        return false;
+    }
+
+    // 파일이 잘렸거나 잘못된 경우 범위 밖을 읽지 않도록 확인
+    // (더하기와 곱하기가 넘치지 않도록 빼기와 나누기로 비교)
+    if (viewOffset > buffer.size || viewLength > buffer.size - viewOffset) {
+        return false;
+    }
+    if (view.count > 0 &&
+        (accessorOffset > viewLength ||
+         elementSize > viewLength - accessorOffset ||
+         view.count - 1 >
+             (viewLength - accessorOffset - elementSize) / view.stride)) {
+        return false;
+    }
+
+    view.data = buffer.data + viewOffset + accessorOffset;
+
+    return true;
+}
+
+bool LoadBuffers(GLTFContext &ctx, const BufferRange &glbBinChunk) {
+
+    if (!ctx.doc.contains("buffers")) {
+        return true;
+    }
+
+    for (const auto &buffer : ctx.doc.at("buffers")) {
+        if (!buffer.contains("uri")) {
+            // GLB의 BIN 청크
+            if (!glbBinChunk.data) {
+                return false;
+            }
+            ctx.buffers.push_back(glbBinChunk);
+            continue;
+        }
+
+        const string uri = buffer.at("uri").get<string>();
+        if (uri.rfind("data:", 0) == 0) {
+            // base64로 내장된 버퍼는 지원하지 않음
+            return false;
+        }
+
+        auto file = make_unique<MappedFile>();
+        if (!file->Open(ctx.basePath + uri)) {
+            cout << "Failed to map buffer: " << ctx.basePath + uri << endl;
+            return false;
+        }
+
+        BufferRange range;
+        range.data = file->Data();
+        range.size = file->Size();
+        ctx.buffers.push_back(range);
+        ctx.files.push_back(std::move(file));
+        ctx.filenames.push_back(ctx.basePath + uri);
+    }
+
+    return true;
+}
+
+// ModelLoader::ReadFilename()과 같은 규칙 (basePath + 파일 이름)
+string ReadFilename(const GLTFContext &ctx, const json &material,
+                    const char *textureInfoName) {
+
+    auto textureInfo = material.find(textureInfoName);
+    if (textureInfo == material.end() || !textureInfo->contains("index")) {
+        return "";
+    }
+
+    const json &texture =
+        ctx.doc.at("textures").at(textureInfo->at("index").get<size_t>());
+    if (!texture.contains("source")) {
+        return "";
+    }
+
+    const json &image =
+        ctx.doc.at("images").at(texture.at("source").get<size_t>());
+    if (!image.contains("uri")) {
+        return ""; // bufferView에 내장된 이미지
+    }
+
+    const string uri = image.at("uri").get<string>();
+    if (uri.rfind("data:", 0) == 0) {
+        return "";
+    }
+
+    return ctx.basePath + filesystem::path(uri).filename().string();
+}
+
+void ReadMaterial(const GLTFContext &ctx, size_t materialIndex,
+                  MeshData &meshData) {
+
+    const json &material = ctx.doc.at("materials").at(materialIndex);
+
+    // Assimp의 glTF2 임포터가 aiTextureType에 연결하는 방식과 동일
+    meshData.emissiveTextureFilename =
+        ReadFilename(ctx, material, "emissiveTexture");
+    meshData.normalTextureFilename =
+        ReadFilename(ctx, material, "normalTexture");
+    meshData.aoTextureFilename =
+        ReadFilename(ctx, material, "occlusionTexture");
+
+    auto pbr = material.find("pbrMetallicRoughness");
+    if (pbr != material.end()) {
+        meshData.albedoTextureFilename =
+            ReadFilename(ctx, *pbr, "baseColorTexture");
+
+        // GLTF는 Metallic과 Roughness가 한 텍스춰에 들어있음
+        meshData.metallicTextureFilename =
+            ReadFilename(ctx, *pbr, "metallicRoughnessTexture");
+        meshData.roughnessTextureFilename = meshData.metallicTextureFilename;
+    }
+}
+
+template <typename T_INDEX>
+void ReadIndices(const AccessorView &view, vector<uint32_t> &indices) {
+
+    // aiProcess_ConvertToLeftHanded의 FlipWindingOrder와 같이
+    // 삼각형마다 (i0, i1, i2) -> (i2, i1, i0)
+    for (size_t i = 0; i + 2 < view.count; i += 3) {
+        indices[i] = uint32_t(*(const T_INDEX *)view.Element(i + 2));
+        indices[i + 1] = uint32_t(*(const T_INDEX *)view.Element(i + 1));
+        indices[i + 2] = uint32_t(*(const T_INDEX *)view.Element(i));
+    }
+}
+
+bool ProcessPrimitive(const GLTFContext &ctx, const json &primitive,
+                      const Matrix &tr, MeshData &newMesh) {
+
+    if (primitive.value("mode", GLTF_TRIANGLES) != GLTF_TRIANGLES) {
+        return false;
+    }
+
+    const json &attributes = primitive.at("attributes");
+    if (!attributes.contains("POSITION")) {
+        return false;
+    }
+
+    AccessorView positions, normals, texcoords;
+    if (!GetAccessor(ctx, attributes.at("POSITION").get<int>(), positions)) {
+        return false;
+    }
+    if (positions.componentType != GLTF_FLOAT || positions.numComponents != 3) {
+        return false;
+    }
+
+    // 노멀이 없으면 0으로 두고 ModelLoader::UpdateNormals()에서 계산
+    const bool hasNormals = attributes.contains("NORMAL");
+    if (hasNormals) {
+        if (!GetAccessor(ctx, attributes.at("NORMAL").get<int>(), normals) ||
+            normals.componentType != GLTF_FLOAT ||
+            normals.numComponents != 3 || normals.count != positions.count) {
+            return false;
+        }
+    }
+
+    const bool hasTexcoords = attributes.contains("TEXCOORD_0");
+    if (hasTexcoords) {
+        if (!GetAccessor(ctx, attributes.at("TEXCOORD_0").get<int>(),
+                         texcoords) ||
+            texcoords.numComponents != 2 ||
+            texcoords.count != positions.count) {
+            return false;
+        }
+        if (texcoords.componentType != GLTF_FLOAT && !texcoords.normalized) {
+            return false;
+        }
+    }
+
+    const size_t numVertices = positions.count;
+    vector<Vertex> &vertices = newMesh.vertices;
+    vertices.resize(numVertices);
+
+    // 1. 위치: 왼손 좌표계로 바꾸기 위한 z 반전과 노드 변환을 행렬 하나로
+    //    합쳐서 한 번에 변환 (ProcessNode()의 Vector3::Transform과 같은 계산)
+    const Matrix flipZ = Matrix::CreateScale(1.0f, 1.0f, -1.0f);
+    if (numVertices > 0) {
+        XMVector3TransformCoordStream(
+            &vertices[0].position, sizeof(Vertex),
+            (const XMFLOAT3 *)positions.data, positions.stride, numVertices,
+            flipZ * tr);
+    }
+
+    // 2. 노멀: z 반전 후 ProcessMesh()의 GLTF 축 변환 (y <- z, z <- -y)
+    //    합치면 (x, y, z) -> (x, -z, -y)
+    const XMVECTOR normalSign = ctx.revertNormals
+                                    ? XMVectorSet(-1.0f, 1.0f, 1.0f, 0.0f)
+                                    : XMVectorSet(1.0f, -1.0f, -1.0f, 0.0f);
+    for (size_t i = 0; hasNormals && i < numVertices; i++) {
+        XMVECTOR n = XMLoadFloat3((const XMFLOAT3 *)normals.Element(i));
+        n = XMVectorMultiply(XMVectorSwizzle<0, 2, 1, 3>(n), normalSign);
+        XMStoreFloat3(&vertices[i].normalModel, XMVector3Normalize(n));
+    }
+
+    // 3. 텍스춰 좌표: Assimp의 glTF2 임포터가 v를 뒤집고
+    //    aiProcess_FlipUVs가 다시 뒤집으므로 원래 값 그대로 사용
+    if (hasTexcoords) {
+        if (texcoords.componentType == GLTF_FLOAT) {
+            for (size_t i = 0; i < numVertices; i++) {
+                vertices[i].texcoord =
+                    *(const XMFLOAT2 *)texcoords.Element(i);
+            }
+        } else if (texcoords.componentType == GLTF_UNSIGNED_SHORT) {
+            for (size_t i = 0; i < numVertices; i++) {
+                const uint16_t *uv = (const uint16_t *)texcoords.Element(i);
+                vertices[i].texcoord =
+                    Vector2(float(uv[0]), float(uv[1])) / 65535.0f;
+            }
+        } else if (texcoords.componentType == GLTF_UNSIGNED_BYTE) {
+            for (size_t i = 0; i < numVertices; i++) {
+                const uint8_t *uv = texcoords.Element(i);
+                vertices[i].texcoord =
+                    Vector2(float(uv[0]), float(uv[1])) / 255.0f;
+            }
+        } else {
+            return false;
+        }
+    }
+
+    // 4. 인덱스
+    vector<uint32_t> &indices = newMesh.indices;
+    if (primitive.contains("indices")) {
+        AccessorView indexView;
+        if (!GetAccessor(ctx, primitive.at("indices").get<int>(), indexView) ||
+            indexView.numComponents != 1 || indexView.count % 3 != 0) {
+            return false;
+        }
+
+        indices.resize(indexView.count);
+        if (indexView.componentType == GLTF_UNSIGNED_INT) {
+            ReadIndices<uint32_t>(indexView, indices);
+        } else if (indexView.componentType == GLTF_UNSIGNED_SHORT) {
+            ReadIndices<uint16_t>(indexView, indices);
+        } else if (indexView.componentType == GLTF_UNSIGNED_BYTE) {
+            ReadIndices<uint8_t>(indexView, indices);
+        } else {
+            return false;
+        }
+
+        for (const auto i : indices) {
+            if (i >= numVertices) {
+                return false;
+            }
+        }
+    } else {
+        // 인덱스가 없으면 버텍스 순서대로 삼각형
+        if (numVertices % 3 != 0) {
+            return false;
+        }
+        indices.resize(numVertices);
+        for (size_t i = 0; i < numVertices; i += 3) {
+            indices[i] = uint32_t(i + 2);
+            indices[i + 1] = uint32_t(i + 1);
+            indices[i + 2] = uint32_t(i);
+        }
+    }
+
+    if (primitive.contains("material")) {
+        ReadMaterial(ctx, primitive.at("material").get<size_t>(), newMesh);
+    }
+
+    return true;
+}
+
+Matrix ReadNodeTransform(const json &node) {
+
+    if (node.contains("matrix")) {
+        // glTF는 column-major로 저장된 column-vector 기준 행렬이므로
+        // 순서대로 읽으면 row-vector 기준(SimpleMath) 행렬이 됨
+        float m[16];
+        for (int i = 0; i < 16; i++) {
+            m[i] = node.at("matrix").at(i).get<float>();
+        }
+        return Matrix(m);
+    }
+
+    Vector3 translation(0.0f);
+    Quaternion rotation;
+    Vector3 scale(1.0f);
+
+    if (node.contains("translation")) {
+        const json &t = node.at("translation");
+        translation = Vector3(t.at(0).get<float>(), t.at(1).get<float>(),
+                              t.at(2).get<float>());
+    }
+    if (node.contains("rotation")) {
+        const json &r = node.at("rotation");
+        rotation = Quaternion(r.at(0).get<float>(), r.at(1).get<float>(),
+                              r.at(2).get<float>(), r.at(3).get<float>());
+    }
+    if (node.contains("scale")) {
+        const json &s = node.at("scale");
+        scale = Vector3(s.at(0).get<float>(), s.at(1).get<float>(),
+                        s.at(2).get<float>());
+    }
+
+    return Matrix::CreateScale(scale) * Matrix::CreateFromQuaternion(rotation) *
+           Matrix::CreateTranslation(translation);
+}
+
+// visited: 노드마다 한 번만 방문 (glTF에서 노드는 부모가 하나뿐이므로
+// 다시 만나면 순환이 있는 잘못된 파일)
+bool ProcessNode(const GLTFContext &ctx, size_t nodeIndex, const Matrix &tr,
+                 vector<bool> &visited, vector<MeshData> &meshes) {
+
+    const json &node = ctx.doc.at("nodes").at(nodeIndex);
+    if (visited[nodeIndex]) {
+        return false;
+    }
+    visited[nodeIndex] = true;
+
+    // MakeLeftHanded와 같이 노드 변환도 z축 기준으로 뒤집음 (F * m * F)
+    Matrix m = ReadNodeTransform(node);
+    m._13 = -m._13;
+    m._23 = -m._23;
+    m._43 = -m._43;
+    m._31 = -m._31;
+    m._32 = -m._32;
+    m._34 = -m._34;
+    m = m * tr;
+
+    if (node.contains("mesh")) {
+        const json &mesh =
+            ctx.doc.at("meshes").at(node.at("mesh").get<size_t>());
+
+        // Assimp와 같이 primitive 하나가 MeshData 하나
+        for (const auto &primitive : mesh.at("primitives")) {
+            MeshData newMesh;
+            if (!ProcessPrimitive(ctx, primitive, m, newMesh)) {
+                return false;
+            }
+            meshes.push_back(std::move(newMesh));
+        }
+    }
+
+    if (node.contains("children")) {
+        for (const auto &child : node.at("children")) {
+            if (!ProcessNode(ctx, child.get<size_t>(), m, visited, meshes)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+bool GLTFLoader::Load(const std::string &basePath, const std::string &filename,
+                      bool revertNormals, std::vector<MeshData> &meshes,
+                      std::vector<std::string> *sourceFiles) {
+
+    MappedFile file;
+    if (!file.Open(basePath + filename)) {
+        cout << "Failed to read file: " << basePath + filename << endl;
+        return false;
+    }
+
+    GLTFContext ctx;
+    ctx.basePath = basePath;
+    ctx.revertNormals = revertNormals;
+
+    const char *jsonBegin = (const char *)file.Data();
+    const char *jsonEnd = jsonBegin + file.Size();
+    BufferRange glbBinChunk;
+
+    // GLB: 12바이트 헤더 + JSON 청크 + (선택) BIN 청크
+    if (file.Size() >= 12 && *(const uint32_t *)file.Data() == GLB_MAGIC) {
+        const uint32_t *header = (const uint32_t *)file.Data();
+        const size_t length = XMMin(size_t(header[2]), file.Size());
+
+        size_t offset = 12;
+        while (offset + 8 <= length) {
+            const uint32_t chunkLength =
+                *(const uint32_t *)(file.Data() + offset);
+            const uint32_t chunkType =
+                *(const uint32_t *)(file.Data() + offset + 4);
+            const uint8_t *chunkData = file.Data() + offset + 8;
+            if (offset + 8 + chunkLength > length) {
+                break;
+            }
+
+            if (chunkType == GLB_CHUNK_JSON) {
+                jsonBegin = (const char *)chunkData;
+                jsonEnd = jsonBegin + chunkLength;
+            } else if (chunkType == GLB_CHUNK_BIN && !glbBinChunk.data) {
+                glbBinChunk.data = chunkData;
+                glbBinChunk.size = chunkLength;
+            }
+
+            offset += 8 + chunkLength;
+        }
+    }
+
+    ctx.doc = json::parse(jsonBegin, jsonEnd, nullptr, false);
+    if (ctx.doc.is_discarded()) {
+        cout << "Failed to parse glTF: " << basePath + filename << endl;
+        return false;
+    }
+
+    vector<MeshData> newMeshes;
+
+    try {
+        if (!LoadBuffers(ctx, glbBinChunk) || !ctx.doc.contains("scenes")) {
+            return false;
+        }
+
+        const json &scene =
+            ctx.doc.at("scenes").at(ctx.doc.value("scene", size_t(0)));
+        if (scene.contains("nodes")) {
+            vector<bool> visited(ctx.doc.at("nodes").size(), false);
+            for (const auto &node : scene.at("nodes")) {
+                if (!ProcessNode(ctx, node.get<size_t>(), Matrix(), visited,
+                                 newMeshes)) {
+                    return false;
+                }
+            }
+        }
+    } catch (const json::exception &e) {
+        cout << "Unsupported glTF: " << basePath + filename << " " << e.what()
+             << endl;
+        return false;
+    }
+
+    meshes = std::move(newMeshes);
+    if (sourceFiles) {
+        sourceFiles->insert(sourceFiles->end(), ctx.filenames.begin(),
+                            ctx.filenames.end());
+    }
+
+    return true;
+}
+
+} // namespace Moon
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "MeshData.h"
+
+namespace Moon {
+
+// Assimp를 거치지 않고 glTF 2.0 (.gltf/.glb)을 직접 읽는 로더
+// https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html
+
+// .bin 버퍼는 메모리 매핑해서 accessor/bufferView를 MeshData로 바로 변환
+// (속성마다 한 번의 변환 패스, 버텍스마다 aiMesh를 거쳐 복사하지 않음)
+// 결과는 ModelLoader의 Assimp 경로
+// (aiProcess_Triangulate | aiProcess_ConvertToLeftHanded + ProcessMesh)와 동일
+// 지원하지 않는 파일(sparse accessor, 삼각형이 아닌 primitive 등)이면
+// false를 반환하고 ModelLoader가 Assimp로 다시 읽음
+
+class GLTFLoader {
+  public:
+    // sourceFiles가 있으면 읽은 외부 버퍼 파일(.bin)들의 경로를 추가
+    static bool Load(const std::string &basePath, const std::string &filename,
+                     bool revertNormals, std::vector<MeshData> &meshes,
+                     std::vector<std::string> *sourceFiles = nullptr);
+};
+
+} // namespace Moon
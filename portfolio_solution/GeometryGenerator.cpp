@@ -1,6 +1,15 @@
 #include "GeometryGenerator.h"
 
+#include <algorithm>
+#include <cfloat>
+#include <unordered_map>
+
+#include "MappedFile.h"
+#include "MeshCache.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
 #include "ModelLoader.h"
+#include "StaticBatcher.h"
 
 namespace Moon {
 
@@ -8,58 +17,25 @@ using namespace std;
 using namespace DirectX;
 using namespace DirectX::SimpleMath;
 
-MeshData GeometryGenerator::MakeSquare(const float scale,
-                                       const Vector2 texScale) {
-    vector<Vector3> positions;
-    vector<Vector3> colors;
-    vector<Vector3> normals;
-    vector<Vector2> texcoords; // 텍스춰 좌표
-
-    // 앞면
-    positions.push_back(Vector3(-1.0f, 1.0f, 0.0f) * scale);
-    positions.push_back(Vector3(1.0f, 1.0f, 0.0f) * scale);
-    positions.push_back(Vector3(1.0f, -1.0f, 0.0f) * scale);
-    positions.push_back(Vector3(-1.0f, -1.0f, 0.0f) * scale);
-    colors.push_back(Vector3(0.0f, 0.0f, 1.0f));
-    colors.push_back(Vector3(0.0f, 0.0f, 1.0f));
-    colors.push_back(Vector3(0.0f, 0.0f, 1.0f));
-    colors.push_back(Vector3(0.0f, 0.0f, 1.0f));
-    normals.push_back(Vector3(0.0f, 0.0f, -1.0f));
-    normals.push_back(Vector3(0.0f, 0.0f, -1.0f));
-    normals.push_back(Vector3(0.0f, 0.0f, -1.0f));
-    normals.push_back(Vector3(0.0f, 0.0f, -1.0f));
-
-    // Texture Coordinates (Direct3D 9)
-    // https://learn.microsoft.com/en-us/windows/win32/direct3d9/texture-coordinates
-    texcoords.push_back(Vector2(0.0f, 0.0f));
-    texcoords.push_back(Vector2(1.0f, 0.0f));
-    texcoords.push_back(Vector2(1.0f, 1.0f));
-    texcoords.push_back(Vector2(0.0f, 1.0f));
-
-    MeshData meshData;
-
-    for (size_t i = 0; i < positions.size(); i++) {
-        Vertex v;
-        v.position = positions[i];
-        v.normalModel = normals[i];
-        v.texcoord = texcoords[i] * texScale;
-        v.tangentModel = Vector3(1.0f, 0.0f, 0.0f);
-
-        // v.color = colors[i];
-
-        meshData.vertices.push_back(v);
+void GeometryGenerator::ScaleVertices(vector<Vertex> &vertices,
+                                      const Vector3 &scale,
+                                      const Vector2 &texScale) {
+    for (auto &v : vertices) {
+        v.position *= scale;
+        v.texcoord *= texScale;
     }
-    meshData.indices = {
-        0, 1, 2, 0, 2, 3, // 앞면
-    };
+}
 
-    return meshData;
+MeshData GeometryGenerator::MakeSquare(const float scale,
+                                       const Vector2 texScale) {
+    return FromTable(PrimitiveTables::square, Vector3(scale), texScale);
 }
 
 MeshData GeometryGenerator::MakeSquareGrid(const int numSlices,
                                            const int numStacks,
                                            const float scale,
-                                           const Vector2 texScale) {
+                                           const Vector2 texScale,
+                                           const bool optimize) {
     MeshData meshData;
 
     float dx = 2.0f / numSlices;
@@ -93,143 +69,16 @@ MeshData GeometryGenerator::MakeSquareGrid(const int numSlices,
         }
     }
 
+    // 가로줄 순서 그대로면 버텍스 캐시를 잘 활용하지 못함
+    if (optimize) {
+        MeshOptimizer::Optimize(meshData);
+    }
+
     return meshData;
 }
 
 MeshData GeometryGenerator::MakeBox(const float scale) {
-
-    vector<Vector3> positions;
-    vector<Vector3> colors;
-    vector<Vector3> normals;
-    vector<Vector2> texcoords; // 텍스춰 좌표
-
-    // 윗면
-    positions.push_back(Vector3(-1.0f, 1.0f, -1.0f) * scale);
-    positions.push_back(Vector3(-1.0f, 1.0f, 1.0f) * scale);
-    positions.push_back(Vector3(1.0f, 1.0f, 1.0f) * scale);
-    positions.push_back(Vector3(1.0f, 1.0f, -1.0f) * scale);
-    colors.push_back(Vector3(1.0f, 0.0f, 0.0f));
-    colors.push_back(Vector3(1.0f, 0.0f, 0.0f));
-    colors.push_back(Vector3(1.0f, 0.0f, 0.0f));
-    colors.push_back(Vector3(1.0f, 0.0f, 0.0f));
-    normals.push_back(Vector3(0.0f, 1.0f, 0.0f));
-    normals.push_back(Vector3(0.0f, 1.0f, 0.0f));
-    normals.push_back(Vector3(0.0f, 1.0f, 0.0f));
-    normals.push_back(Vector3(0.0f, 1.0f, 0.0f));
-    texcoords.push_back(Vector2(0.0f, 0.0f));
-    texcoords.push_back(Vector2(1.0f, 0.0f));
-    texcoords.push_back(Vector2(1.0f, 1.0f));
-    texcoords.push_back(Vector2(0.0f, 1.0f));
-
-    // 아랫면
-    positions.push_back(Vector3(-1.0f, -1.0f, -1.0f) * scale);
-    positions.push_back(Vector3(1.0f, -1.0f, -1.0f) * scale);
-    positions.push_back(Vector3(1.0f, -1.0f, 1.0f) * scale);
-    positions.push_back(Vector3(-1.0f, -1.0f, 1.0f) * scale);
-    colors.push_back(Vector3(0.0f, 1.0f, 0.0f));
-    colors.push_back(Vector3(0.0f, 1.0f, 0.0f));
-    colors.push_back(Vector3(0.0f, 1.0f, 0.0f));
-    colors.push_back(Vector3(0.0f, 1.0f, 0.0f));
-    normals.push_back(Vector3(0.0f, -1.0f, 0.0f));
-    normals.push_back(Vector3(0.0f, -1.0f, 0.0f));
-    normals.push_back(Vector3(0.0f, -1.0f, 0.0f));
-    normals.push_back(Vector3(0.0f, -1.0f, 0.0f));
-    texcoords.push_back(Vector2(0.0f, 0.0f));
-    texcoords.push_back(Vector2(1.0f, 0.0f));
-    texcoords.push_back(Vector2(1.0f, 1.0f));
-    texcoords.push_back(Vector2(0.0f, 1.0f));
-
-    // 앞면
-    positions.push_back(Vector3(-1.0f, -1.0f, -1.0f) * scale);
-    positions.push_back(Vector3(-1.0f, 1.0f, -1.0f) * scale);
-    positions.push_back(Vector3(1.0f, 1.0f, -1.0f) * scale);
-    positions.push_back(Vector3(1.0f, -1.0f, -1.0f) * scale);
-    colors.push_back(Vector3(0.0f, 0.0f, 1.0f));
-    colors.push_back(Vector3(0.0f, 0.0f, 1.0f));
-    colors.push_back(Vector3(0.0f, 0.0f, 1.0f));
-    colors.push_back(Vector3(0.0f, 0.0f, 1.0f));
-    normals.push_back(Vector3(0.0f, 0.0f, -1.0f));
-    normals.push_back(Vector3(0.0f, 0.0f, -1.0f));
-    normals.push_back(Vector3(0.0f, 0.0f, -1.0f));
-    normals.push_back(Vector3(0.0f, 0.0f, -1.0f));
-    texcoords.push_back(Vector2(0.0f, 0.0f));
-    texcoords.push_back(Vector2(1.0f, 0.0f));
-    texcoords.push_back(Vector2(1.0f, 1.0f));
-    texcoords.push_back(Vector2(0.0f, 1.0f));
-
-    // 뒷면
-    positions.push_back(Vector3(-1.0f, -1.0f, 1.0f) * scale);
-    positions.push_back(Vector3(1.0f, -1.0f, 1.0f) * scale);
-    positions.push_back(Vector3(1.0f, 1.0f, 1.0f) * scale);
-    positions.push_back(Vector3(-1.0f, 1.0f, 1.0f) * scale);
-    colors.push_back(Vector3(0.0f, 1.0f, 1.0f));
-    colors.push_back(Vector3(0.0f, 1.0f, 1.0f));
-    colors.push_back(Vector3(0.0f, 1.0f, 1.0f));
-    colors.push_back(Vector3(0.0f, 1.0f, 1.0f));
-    normals.push_back(Vector3(0.0f, 0.0f, 1.0f));
-    normals.push_back(Vector3(0.0f, 0.0f, 1.0f));
-    normals.push_back(Vector3(0.0f, 0.0f, 1.0f));
-    normals.push_back(Vector3(0.0f, 0.0f, 1.0f));
-    texcoords.push_back(Vector2(0.0f, 0.0f));
-    texcoords.push_back(Vector2(1.0f, 0.0f));
-    texcoords.push_back(Vector2(1.0f, 1.0f));
-    texcoords.push_back(Vector2(0.0f, 1.0f));
-
-    // 왼쪽
-    positions.push_back(Vector3(-1.0f, -1.0f, 1.0f) * scale);
-    positions.push_back(Vector3(-1.0f, 1.0f, 1.0f) * scale);
-    positions.push_back(Vector3(-1.0f, 1.0f, -1.0f) * scale);
-    positions.push_back(Vector3(-1.0f, -1.0f, -1.0f) * scale);
-    colors.push_back(Vector3(1.0f, 1.0f, 0.0f));
-    colors.push_back(Vector3(1.0f, 1.0f, 0.0f));
-    colors.push_back(Vector3(1.0f, 1.0f, 0.0f));
-    colors.push_back(Vector3(1.0f, 1.0f, 0.0f));
-    normals.push_back(Vector3(-1.0f, 0.0f, 0.0f));
-    normals.push_back(Vector3(-1.0f, 0.0f, 0.0f));
-    normals.push_back(Vector3(-1.0f, 0.0f, 0.0f));
-    normals.push_back(Vector3(-1.0f, 0.0f, 0.0f));
-    texcoords.push_back(Vector2(0.0f, 0.0f));
-    texcoords.push_back(Vector2(1.0f, 0.0f));
-    texcoords.push_back(Vector2(1.0f, 1.0f));
-    texcoords.push_back(Vector2(0.0f, 1.0f));
-
-    // 오른쪽
-    positions.push_back(Vector3(1.0f, -1.0f, 1.0f) * scale);
-    positions.push_back(Vector3(1.0f, -1.0f, -1.0f) * scale);
-    positions.push_back(Vector3(1.0f, 1.0f, -1.0f) * scale);
-    positions.push_back(Vector3(1.0f, 1.0f, 1.0f) * scale);
-    colors.push_back(Vector3(1.0f, 0.0f, 1.0f));
-    colors.push_back(Vector3(1.0f, 0.0f, 1.0f));
-    colors.push_back(Vector3(1.0f, 0.0f, 1.0f));
-    colors.push_back(Vector3(1.0f, 0.0f, 1.0f));
-    normals.push_back(Vector3(1.0f, 0.0f, 0.0f));
-    normals.push_back(Vector3(1.0f, 0.0f, 0.0f));
-    normals.push_back(Vector3(1.0f, 0.0f, 0.0f));
-    normals.push_back(Vector3(1.0f, 0.0f, 0.0f));
-    texcoords.push_back(Vector2(0.0f, 0.0f));
-    texcoords.push_back(Vector2(1.0f, 0.0f));
-    texcoords.push_back(Vector2(1.0f, 1.0f));
-    texcoords.push_back(Vector2(0.0f, 1.0f));
-
-    MeshData meshData;
-    for (size_t i = 0; i < positions.size(); i++) {
-        Vertex v;
-        v.position = positions[i];
-        v.normalModel = normals[i];
-        v.texcoord = texcoords[i];
-        meshData.vertices.push_back(v);
-    }
-
-    meshData.indices = {
-        0,  1,  2,  0,  2,  3,  // 윗면
-        4,  5,  6,  4,  6,  7,  // 아랫면
-        8,  9,  10, 8,  10, 11, // 앞면
-        12, 13, 14, 12, 14, 15, // 뒷면
-        16, 17, 18, 16, 18, 19, // 왼쪽
-        20, 21, 22, 20, 22, 23  // 오른쪽
-    };
-
-    return meshData;
+    return FromTable(PrimitiveTables::box, Vector3(scale), Vector2(1.0f));
 }
 
 MeshData GeometryGenerator::MakeCylinder(const float bottomRadius,
@@ -290,7 +139,8 @@ MeshData GeometryGenerator::MakeCylinder(const float bottomRadius,
 
 MeshData GeometryGenerator::MakeSphere(const float radius, const int numSlices,
                                        const int numStacks,
-                                       const Vector2 texScale) {
+                                       const Vector2 texScale,
+                                       const bool optimize) {
 
     // 참고: OpenGL Sphere
     // http://www.songho.ca/opengl/gl_sphere.html
@@ -368,213 +218,297 @@ MeshData GeometryGenerator::MakeSphere(const float radius, const int numSlices,
     // }
     // cout << endl;
 
+    if (optimize) {
+        MeshOptimizer::Optimize(meshData);
+    }
+
     return meshData;
 }
 
 MeshData GeometryGenerator::MakeIcosahedron() {
+    return FromTable(PrimitiveTables::icosahedron, Vector3(1.0f),
+                     Vector2(1.0f));
+}
 
-    // Luna DX12 교재 참고
-    // 등20면체
-    // https://mathworld.wolfram.com/Isohedron.html
-
-    const float X = 0.525731f;
-    const float Z = 0.850651f;
+MeshData GeometryGenerator::MakeTetrahedron() {
+    return FromTable(PrimitiveTables::tetrahedron, Vector3(1.0f),
+                     Vector2(1.0f));
+}
 
-    MeshData newMesh;
+MeshData GeometryGenerator::SubdivideToSphere(const float radius,
+                                              const MeshData &meshData,
+                                              const int numLevels,
+                                              const bool sphericalTexcoords) {
 
-    vector<Vector3> pos = {
-        Vector3(-X, 0.0f, Z), Vector3(X, 0.0f, Z),   Vector3(-X, 0.0f, -Z),
-        Vector3(X, 0.0f, -Z), Vector3(0.0f, Z, X),   Vector3(0.0f, Z, -X),
-        Vector3(0.0f, -Z, X), Vector3(0.0f, -Z, -X), Vector3(Z, X, 0.0f),
-        Vector3(-Z, X, 0.0f), Vector3(Z, -X, 0.0f),  Vector3(-Z, -X, 0.0f)};
+    // 모서리 중점을 (작은 인덱스, 큰 인덱스) 키로 캐시해서 이웃 삼각형과
+    // 공유하는 인덱스 구조, 닫힌 메쉬라면 한 단계마다 V + F * 3 / 2 버텍스
+    // 참고: Luna DX12 교재 GeometryGenerator::Subdivide()
 
-    for (size_t i = 0; i < pos.size(); i++) {
-        Vertex v;
-        v.position = pos[i];
+    // 원점이 중심이라고 가정하고 구의 표면으로 옮김
+    auto ProjectVertex = [&](Vertex &v) {
         v.normalModel = v.position;
         v.normalModel.Normalize();
+        v.position = v.normalModel * radius;
+    };
 
-        newMesh.vertices.push_back(v);
+    MeshData newMesh;
+    vector<Vertex> &vertices = newMesh.vertices;
+    vector<uint32_t> &indices = newMesh.indices;
+
+    // 닫힌 메쉬 기준으로 결과 크기를 미리 계산
+    const int levels = std::max(numLevels, 0);
+    size_t numVertices = meshData.vertices.size();
+    size_t numTriangles = meshData.indices.size() / 3;
+    for (int level = 0; level < levels; level++) {
+        numVertices += numTriangles * 3 / 2;
+        numTriangles *= 4;
+    }
+    vertices.reserve(numVertices);
+    indices.reserve(numTriangles * 3);
+
+    vertices = meshData.vertices;
+    for (auto &v : vertices) {
+        ProjectVertex(v);
+    }
+    indices.assign(meshData.indices.begin(),
+                   meshData.indices.begin() + meshData.indices.size() / 3 * 3);
+
+    // 단계마다 두 버퍼를 맞바꾸므로 마지막 단계가 어느 쪽에 쓰더라도
+    // 재할당이 없도록 둘 다 최종 크기로 예약
+    vector<uint32_t> prevIndices;
+    prevIndices.reserve(numTriangles * 3);
+    unordered_map<uint64_t, uint32_t> midpoints;
+
+    for (int level = 0; level < levels; level++) {
+        indices.swap(prevIndices);
+        indices.clear();
+        midpoints.clear();
+        midpoints.reserve(prevIndices.size() / 2);
+
+        auto Midpoint = [&](uint32_t i0, uint32_t i1) {
+            const uint64_t key = (uint64_t(std::min(i0, i1)) << 32) |
+                                 uint64_t(std::max(i0, i1));
+            auto result = midpoints.try_emplace(key, uint32_t(vertices.size()));
+            if (result.second) {
+                Vertex v;
+                v.position = (vertices[i0].position + vertices[i1].position) *
+                             0.5f;
+                v.texcoord = (vertices[i0].texcoord + vertices[i1].texcoord) *
+                             0.5f;
+                ProjectVertex(v);
+                vertices.push_back(v);
+            }
+            return result.first->second;
+        };
+
+        for (size_t i = 0; i < prevIndices.size(); i += 3) {
+            const uint32_t i0 = prevIndices[i];
+            const uint32_t i1 = prevIndices[i + 1];
+            const uint32_t i2 = prevIndices[i + 2];
+
+            const uint32_t i3 = Midpoint(i0, i2);
+            const uint32_t i4 = Midpoint(i0, i1);
+            const uint32_t i5 = Midpoint(i1, i2);
+
+            indices.insert(indices.end(), {i4, i1, i5, i0, i4, i3, i3, i4, i5,
+                                           i3, i5, i2});
+        }
     }
 
-    newMesh.indices = {1,  4,  0, 4,  9, 0, 4, 5,  9, 8, 5, 4,  1,  8, 4,
-                       1,  10, 8, 10, 3, 8, 8, 3,  5, 3, 2, 5,  3,  7, 2,
-                       3,  10, 7, 10, 6, 7, 6, 11, 7, 6, 0, 11, 6,  1, 0,
-                       10, 1,  6, 11, 0, 9, 2, 11, 9, 5, 2, 9,  11, 2, 7};
+    if (sphericalTexcoords) {
+        UpdateSphericalTexcoords(newMesh);
+    }
 
     return newMesh;
 }
 
-MeshData GeometryGenerator::MakeTetrahedron() {
+void GeometryGenerator::UpdateSphericalTexcoords(MeshData &meshData) {
 
-    // Regular Tetrahedron
-    // https://mathworld.wolfram.com/RegularTetrahedron.html
+    // 원점이 중심인 구의 위도/경도로 텍스춰 좌표 계산
+    // u = 0/1 이음매(-x 방향)를 지나는 삼각형은 이음매 버텍스를 복제해서
+    // u에 1을 더하고, 극점(u가 정해지지 않는 점)은 삼각형마다 복제해서
+    // 나머지 두 버텍스의 u 평균을 사용 (Wrap 샘플러 가정)
+    // atan vs atan2
+    // https://stackoverflow.com/questions/283406/what-is-the-difference-between-atan-and-atan2-in-c
 
-    const float a = 1.0f;
-    const float x = sqrt(3.0f) / 3.0f * a;
-    const float d = sqrt(3.0f) / 6.0f * a; // = x / 2
-    const float h = sqrt(6.0f) / 3.0f * a;
+    vector<Vertex> &vertices = meshData.vertices;
+    vector<uint32_t> &indices = meshData.indices;
 
-    vector<Vector3> points = {{0.0f, x, 0.0f},
-                              {-0.5f * a, -d, 0.0f},
-                              {+0.5f * a, -d, 0.0f},
-                              {0.0f, 0.0f, h}};
+    // u 방향(dP/du)의 탄젠트
+    auto SetTexcoord = [](Vertex &v, const float u) {
+        const float theta = u * XM_2PI - XM_PI;
+        v.texcoord.x = u;
+        v.tangentModel = Vector3(-sinf(theta), 0.0f, cosf(theta));
+    };
 
-    Vector3 center = Vector3(0.0f);
+    const size_t numOriginal = vertices.size();
+    vector<bool> isPole(numOriginal, false);
+    for (size_t i = 0; i < numOriginal; i++) {
+        Vertex &v = vertices[i];
+        const float r = v.position.Length();
+        const float horizontal = sqrtf(v.position.x * v.position.x +
+                                       v.position.z * v.position.z);
+        isPole[i] = horizontal <= r * 1e-6f;
+
+        float u = 0.0f;
+        if (!isPole[i]) {
+            u = atan2f(v.position.z, v.position.x) / XM_2PI + 0.5f;
+            u = u >= 1.0f ? u - 1.0f : u; // [0, 1)
+        }
+        SetTexcoord(v, u);
 
-    for (int i = 0; i < 4; i++) {
-        center += points[i];
+        const float cosPhi =
+            r > 0.0f ? std::clamp(v.position.y / r, -1.0f, 1.0f) : 1.0f;
+        v.texcoord.y = acosf(cosPhi) / XM_PI;
     }
-    center /= 4.0f;
 
-    for (int i = 0; i < 4; i++) {
-        points[i] -= center;
-    }
+    vector<uint32_t> seamCopies(numOriginal, UINT32_MAX);
+    vector<bool> poleUsed(numOriginal, false);
 
-    MeshData meshData;
+    for (size_t i = 0; i < indices.size(); i += 3) {
+        uint32_t *tri = &indices[i];
 
-    for (int i = 0; i < points.size(); i++) {
+        float minU = 1.0f, maxU = 0.0f;
+        for (int k = 0; k < 3; k++) {
+            if (!isPole[tri[k]]) {
+                minU = std::min(minU, vertices[tri[k]].texcoord.x);
+                maxU = std::max(maxU, vertices[tri[k]].texcoord.x);
+            }
+        }
 
-        Vertex v;
-        v.position = points[i];
-        v.normalModel = v.position; // 중심이 원점
-        v.normalModel.Normalize();
+        // 이음매를 지나는 삼각형
+        if (maxU - minU > 0.5f) {
+            for (int k = 0; k < 3; k++) {
+                const uint32_t index = tri[k];
+                if (isPole[index] || vertices[index].texcoord.x >= 0.5f) {
+                    continue;
+                }
+                if (seamCopies[index] == UINT32_MAX) {
+                    Vertex v = vertices[index];
+                    SetTexcoord(v, v.texcoord.x + 1.0f);
+                    seamCopies[index] = uint32_t(vertices.size());
+                    vertices.push_back(v);
+                }
+                tri[k] = seamCopies[index];
+            }
+        }
 
-        meshData.vertices.push_back(v);
+        for (int k = 0; k < 3; k++) {
+            const uint32_t index = tri[k];
+            if (index >= numOriginal || !isPole[index]) {
+                continue;
+            }
+
+            const float u = (vertices[tri[(k + 1) % 3]].texcoord.x +
+                             vertices[tri[(k + 2) % 3]].texcoord.x) *
+                            0.5f;
+            if (poleUsed[index]) {
+                Vertex v = vertices[index];
+                SetTexcoord(v, u);
+                tri[k] = uint32_t(vertices.size());
+                vertices.push_back(v);
+            } else {
+                SetTexcoord(vertices[index], u);
+                poleUsed[index] = true;
+            }
+        }
     }
-
-    meshData.indices = {0, 1, 2, 3, 2, 1, 0, 3, 1, 0, 2, 3};
-
-    return meshData;
 }
-MeshData GeometryGenerator::SubdivideToSphere(const float radius,
-                                              MeshData meshData) {
 
-    using namespace DirectX;
-    using DirectX::SimpleMath::Matrix;
-    using DirectX::SimpleMath::Vector3;
+namespace {
 
-    // 원점이 중심이라고 가정
-    for (auto &v : meshData.vertices) {
-        v.position = v.normalModel * radius;
-    }
-
-    // 구의 표면으로 옮기고 노멀과 texture 좌표 계산
-    auto ProjectVertex = [&](Vertex &v) {
-        v.normalModel = v.position;
-        v.normalModel.Normalize();
-        v.position = v.normalModel * radius;
-
-        // 주의: 텍스춰가 이음매에서 깨집니다.
-        // atan vs atan2
-        // https://stackoverflow.com/questions/283406/what-is-the-difference-between-atan-and-atan2-in-c
-        // const float theta = atan2f(v.position.z, v.position.x);
-        // const float phi = acosf(v.position.y / radius);
-        // v.texcoord.x = theta / XM_2PI;
-        // v.texcoord.y = phi / XM_PI;
-    };
-
-    auto UpdateFaceNormal = [](Vertex &v0, Vertex &v1, Vertex &v2) {
-        auto faceNormal =
-            (v1.position - v0.position).Cross(v2.position - v0.position);
-        faceNormal.Normalize();
-        v0.normalModel = faceNormal;
-        v1.normalModel = faceNormal;
-        v2.normalModel = faceNormal;
+// 결과 MeshData에 영향을 주는 옵션들 (printStats 같은 출력 옵션은 제외)
+// 옵션을 바꾸면 CACHE_VERSION을 올리지 않아도 캐시를 다시 만듦
+uint64_t HashImportOptions(const ModelLoader &loader,
+                           const BatchOptions &batch, const LodOptions &lod) {
+    uint64_t hash = HashBytes(nullptr, 0);
+    auto add = [&](const auto &value) {
+        hash = HashBytes((const uint8_t *)&value, sizeof(value), hash);
     };
 
-    // 버텍스가 중복되는 구조로 구현
-    MeshData newMesh;
-    uint32_t count = 0;
-    for (size_t i = 0; i < meshData.indices.size(); i += 3) {
-        size_t i0 = meshData.indices[i];
-        size_t i1 = meshData.indices[i + 1];
-        size_t i2 = meshData.indices[i + 2];
-
-        Vertex v0 = meshData.vertices[i0];
-        Vertex v1 = meshData.vertices[i1];
-        Vertex v2 = meshData.vertices[i2];
-
-        Vertex v3;
-        v3.position = (v0.position + v2.position) * 0.5f;
-        v3.texcoord = (v0.texcoord + v2.texcoord) * 0.5f;
-        ProjectVertex(v3);
-
-        Vertex v4;
-        v4.position = (v0.position + v1.position) * 0.5f;
-        v4.texcoord = (v0.texcoord + v1.texcoord) * 0.5f;
-        ProjectVertex(v4);
-
-        Vertex v5;
-        v5.position = (v1.position + v2.position) * 0.5f;
-        v5.texcoord = (v1.texcoord + v2.texcoord) * 0.5f;
-        ProjectVertex(v5);
-
-        // UpdateFaceNormal(v4, v1, v5);
-        // UpdateFaceNormal(v0, v4, v3);
-        // UpdateFaceNormal(v3, v4, v5);
-        // UpdateFaceNormal(v3, v5, v2);
-
-        newMesh.vertices.push_back(v4);
-        newMesh.vertices.push_back(v1);
-        newMesh.vertices.push_back(v5);
-
-        newMesh.vertices.push_back(v0);
-        newMesh.vertices.push_back(v4);
-        newMesh.vertices.push_back(v3);
-
-        newMesh.vertices.push_back(v3);
-        newMesh.vertices.push_back(v4);
-        newMesh.vertices.push_back(v5);
-
-        newMesh.vertices.push_back(v3);
-        newMesh.vertices.push_back(v5);
-        newMesh.vertices.push_back(v2);
-
-        for (uint32_t j = 0; j < 12; j++) {
-            newMesh.indices.push_back(j + count);
-        }
-        count += 12;
+    add(loader.m_useNativeGLTF);
+    add(loader.m_weldVertices);
+    add(loader.m_optimizeMeshes);
+    add(loader.m_generateNormals);
+    add(loader.m_creaseAngle);
+    add(loader.m_weldOptions.positionEpsilon);
+    add(loader.m_weldOptions.normalEpsilon);
+    add(loader.m_weldOptions.texcoordEpsilon);
+    add(loader.m_weldOptions.tangentEpsilon);
+    add(loader.m_optimizeOptions.optimizeOverdraw);
+    add(loader.m_optimizeOptions.overdrawThreshold);
+    add(loader.m_optimizeOptions.fifoCacheSize);
+
+    add(batch.maxVertices);
+    add(batch.maxIndices);
+    add(batch.maxExtent);
+
+    add(lod.ratios.size());
+    for (const float ratio : lod.ratios) {
+        add(ratio);
     }
+    add(lod.minTriangles);
+    add(lod.simplify.normalWeight);
+    add(lod.simplify.lockSeams);
+    add(lod.simplify.lockBorders);
 
-    return newMesh;
+    return hash;
 }
+
+} // namespace
+
 vector<MeshData> GeometryGenerator::ReadFromFile(std::string basePath,
                                                  std::string filename, bool revertNormals) {
 
     using namespace DirectX;
 
     ModelLoader modelLoader;
+    BatchOptions batchOptions;
+    LodOptions lodOptions;
+
+    // 이전에 같은 옵션으로 읽어서 저장해둔 결과가 있으면 그대로 사용
+    const uint64_t optionsHash =
+        HashImportOptions(modelLoader, batchOptions, lodOptions);
+    vector<MeshData> cached;
+    if (MeshCache::Read(basePath, filename, revertNormals, optionsHash,
+                        cached)) {
+        return cached;
+    }
+
     modelLoader.Load(basePath, filename, revertNormals);
     vector<MeshData> &meshes = modelLoader.meshes;
 
     // Normalize vertices
-    Vector3 vmin(1000, 1000, 1000);
-    Vector3 vmax(-1000, -1000, -1000);
+    Vector3 vmin(FLT_MAX), vmax(-FLT_MAX);
     for (auto &mesh : meshes) {
-        for (auto &v : mesh.vertices) {
-            vmin.x = XMMin(vmin.x, v.position.x);
-            vmin.y = XMMin(vmin.y, v.position.y);
-            vmin.z = XMMin(vmin.z, v.position.z);
-            vmax.x = XMMax(vmax.x, v.position.x);
-            vmax.y = XMMax(vmax.y, v.position.y);
-            vmax.z = XMMax(vmax.z, v.position.z);
-        }
+        Vector3 meshMin, meshMax;
+        BoundsBuilder::MinMax(mesh.vertices, meshMin, meshMax);
+        vmin = Vector3::Min(vmin, meshMin);
+        vmax = Vector3::Max(vmax, meshMax);
     }
 
-    float dx = vmax.x - vmin.x, dy = vmax.y - vmin.y, dz = vmax.z - vmin.z;
-    float dl = XMMax(XMMax(dx, dy), dz);
-    float cx = (vmax.x + vmin.x) * 0.5f, cy = (vmax.y + vmin.y) * 0.5f,
-          cz = (vmax.z + vmin.z) * 0.5f;
+    const Vector3 extent = vmax - vmin;
+    const float dl = XMMax(XMMax(extent.x, extent.y), extent.z);
+    const Vector3 center = (vmax + vmin) * 0.5f;
 
+    // 옮기는 루프에서 메쉬별 최소/최대도 같이 구해서 바운딩 볼륨 계산
     for (auto &mesh : meshes) {
-        for (auto &v : mesh.vertices) {
-            v.position.x = (v.position.x - cx) / dl;
-            v.position.y = (v.position.y - cy) / dl;
-            v.position.z = (v.position.z - cz) / dl;
-        }
+        Vector3 meshMin, meshMax;
+        BoundsBuilder::NormalizeMinMax(mesh.vertices, center, 1.0f / dl,
+                                       meshMin, meshMax);
+        mesh.bounds = BoundsBuilder::Compute(mesh.vertices, meshMin, meshMax);
     }
 
-    return meshes;
+    // 재질이 같은 작은 메쉬들을 합침 (LOD는 합친 메쉬에서 만듦)
+    StaticBatcher::Batch(meshes, batchOptions);
+
+    // 멀리 있을 때 사용할 LOD들 (캐시에 같이 저장)
+    MeshSimplifier::GenerateLods(meshes, lodOptions);
+
+    MeshCache::Write(basePath, filename, revertNormals, optionsHash, meshes,
+                     modelLoader.sourceFiles);
+
+    // modelLoader.meshes를 복사하지 않고 넘겨줌
+    return std::move(meshes);
 }
 } // namespace hlab
\ No newline at end of file
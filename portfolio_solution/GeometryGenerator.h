@@ -5,11 +5,13 @@
 #include <vector>
 
 #include "MeshData.h"
+#include "PrimitiveTables.h"
 #include "Vertex.h"
 
 namespace Moon {
 
 using DirectX::SimpleMath::Vector2;
+using DirectX::SimpleMath::Vector3;
 
 class GeometryGenerator {
   public:
@@ -19,18 +21,85 @@ class GeometryGenerator {
 
     static MeshData MakeSquare(const float scale = 1.0f,
                                const Vector2 texScale = Vector2(1.0f));
+    // optimize: 인덱스/버텍스 순서를 MeshOptimizer로 바꿈
+    //           (false면 가로줄 순서 그대로)
     static MeshData MakeSquareGrid(const int numSlices, const int numStacks,
                                    const float scale = 1.0f,
-                                   const Vector2 texScale = Vector2(1.0f));
+                                   const Vector2 texScale = Vector2(1.0f),
+                                   const bool optimize = false);
     static MeshData MakeBox(const float scale = 1.0f);
     static MeshData MakeCylinder(const float bottomRadius,
                                  const float topRadius, float height,
                                  int numSlices);
     static MeshData MakeSphere(const float radius, const int numSlices,
                                const int numStacks,
-                               const Vector2 texScale = Vector2(1.0f));
+                               const Vector2 texScale = Vector2(1.0f),
+                               const bool optimize = false);
     static MeshData MakeTetrahedron();
     static MeshData MakeIcosahedron();
-    static MeshData SubdivideToSphere(const float radius, MeshData meshData);
+
+    // 분할 개수가 컴파일 타임에 정해진 버전
+    // 단위 크기 메쉬를 한 번만 만들어 두고 복사해서 크기만 조절
+    template <int numSlices, int numStacks>
+    static MeshData MakeSphere(const float radius,
+                               const Vector2 texScale = Vector2(1.0f)) {
+        static_assert(numSlices >= 3 && numStacks >= 2);
+        static const MeshData unitSphere =
+            MakeSphere(1.0f, numSlices, numStacks);
+
+        MeshData meshData;
+        meshData.vertices = unitSphere.vertices;
+        meshData.indices = unitSphere.indices;
+        meshData.lodIndices = unitSphere.lodIndices;
+        ScaleVertices(meshData.vertices, Vector3(radius), texScale);
+        return meshData;
+    }
+
+    template <int numSlices>
+    static MeshData MakeCylinder(const float bottomRadius,
+                                 const float topRadius, const float height) {
+        static_assert(numSlices >= 3);
+        static const MeshData unitCylinder =
+            MakeCylinder(1.0f, 1.0f, 1.0f, numSlices);
+        constexpr auto indices = PrimitiveTables::CylinderIndices<numSlices>();
+
+        MeshData meshData;
+        meshData.vertices = unitCylinder.vertices;
+        meshData.indices.assign(indices.begin(), indices.end());
+
+        // 앞쪽 numSlices + 1개는 아래쪽 링, 나머지는 위쪽 링
+        for (size_t i = 0; i < meshData.vertices.size(); i++) {
+            const float radius =
+                i <= size_t(numSlices) ? bottomRadius : topRadius;
+            Vector3 &p = meshData.vertices[i].position;
+            p = Vector3(p.x * radius, p.y * height, p.z * radius);
+        }
+        return meshData;
+    }
+
+    // 인덱스를 공유하며 numLevels 단계를 한 번에 분할 (삼각형 4^numLevels배)
+    // sphericalTexcoords가 false면 원래 텍스춰 좌표를 보간
+    static MeshData SubdivideToSphere(const float radius,
+                                      const MeshData &meshData,
+                                      const int numLevels = 1,
+                                      const bool sphericalTexcoords = true);
+
+  private:
+    template <size_t NumVertices, size_t NumIndices>
+    static MeshData
+    FromTable(const PrimitiveTable<NumVertices, NumIndices> &table,
+              const Vector3 &scale, const Vector2 &texScale) {
+        MeshData meshData;
+        meshData.vertices.assign(table.vertices.begin(), table.vertices.end());
+        meshData.indices.assign(table.indices.begin(), table.indices.end());
+        ScaleVertices(meshData.vertices, scale, texScale);
+        return meshData;
+    }
+
+    static void ScaleVertices(vector<Vertex> &vertices, const Vector3 &scale,
+                              const Vector2 &texScale);
+
+    // 위도/경도 텍스춰 좌표와 탄젠트, 이음매와 극점의 버텍스는 복제
+    static void UpdateSphericalTexcoords(MeshData &meshData);
 };
 } // namespace hlab
@@ -0,0 +1,120 @@
+#include "GeometryRegistry.h"
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+
+#include "D3D11Utils.h"
+#include "MeshletBuilder.h"
+
+namespace Moon {
+
+using namespace std;
+
+GeometryRegistry &GeometryRegistry::Get() {
+    static GeometryRegistry registry;
+    return registry;
+}
+
+string GeometryRegistry::MakeKey(const string &generator,
+                                 const vector<float> &params) {
+    ostringstream key;
+    key << "/" << generator << std::hexfloat;
+    for (const float p : params) {
+        key << "|" << p;
+    }
+    return key.str();
+}
+
+shared_ptr<MeshGeometry>
+GeometryRegistry::Upload(ComPtr<ID3D11Device> &device,
+                         const MeshData &meshData,
+                         const PackingBounds *packingBounds, bool printStats) {
+
+    auto geometry = make_shared<MeshGeometry>();
+
+    // 임포트할 때 구해 둔 바운딩 볼륨이 없으면 (절차적 메쉬) 여기서 계산
+    geometry->bounds = meshData.bounds.isValid
+                           ? meshData.bounds
+                           : BoundsBuilder::Compute(meshData.vertices);
+
+    if (packingBounds) {
+        std::vector<PackedVertex> packed;
+        VertexPacker::Pack(meshData.vertices, *packingBounds, packed);
+        D3D11Utils::CreateVertexBuffer(device, packed,
+                                       geometry->vertexBuffer);
+        geometry->stride = UINT(sizeof(PackedVertex));
+        geometry->isPacked = true;
+        geometry->packingBounds = *packingBounds;
+
+        if (printStats) {
+            const PackingError error = VertexPacker::MeasureError(
+                meshData.vertices, packed, *packingBounds);
+            cout << "Packed vertices: " << packed.size() << " x "
+                 << sizeof(PackedVertex) << " bytes (was " << sizeof(Vertex)
+                 << "), max error position " << error.position << ", normal "
+                 << error.normal << " deg, tangent " << error.tangent
+                 << " deg, texcoord " << error.texcoord << endl;
+        }
+    } else {
+        D3D11Utils::CreateVertexBuffer(device, meshData.vertices,
+                                       geometry->vertexBuffer);
+        geometry->stride = UINT(sizeof(Vertex));
+    }
+    geometry->indexCount = UINT(meshData.indices.size());
+    geometry->vertexCount = UINT(meshData.vertices.size());
+
+    // LOD0은 Meshlet 순서로 정렬 (Meshlet이 하나뿐이면 그대로 사용)
+    vector<uint32_t> indices = meshData.indices;
+    if (indices.size() / 3 > MeshletOptions().maxTriangles) {
+        vector<Meshlet> meshlets;
+        MeshletBuilder::Build(meshData.vertices, indices, meshlets);
+        geometry->meshlets =
+            make_shared<const vector<Meshlet>>(std::move(meshlets));
+    }
+
+    // LOD들은 인덱스 버퍼 하나에 이어서 저장
+    vector<MeshLod> lods = {{geometry->indexCount, 0}};
+    for (const auto &lod : meshData.lodIndices) {
+        lods.push_back({UINT(lod.size()), UINT(indices.size())});
+        indices.insert(indices.end(), lod.begin(), lod.end());
+    }
+    geometry->lods = make_shared<const vector<MeshLod>>(std::move(lods));
+    D3D11Utils::CreateIndexBuffer(device, indices, geometry->indexBuffer);
+
+    geometry->bytes = size_t(geometry->vertexCount) * geometry->stride +
+                      indices.size() * sizeof(uint32_t);
+
+    return geometry;
+}
+
+shared_ptr<const MeshGeometry>
+GeometryRegistry::GetOrCreate(ComPtr<ID3D11Device> &device, const string &key,
+                              const function<MeshData()> &generate) {
+
+    lock_guard<mutex> lock(m_mutex);
+
+    auto it = m_byKey.find(key);
+    if (it != m_byKey.end()) {
+        if (auto geometry = it->second.lock()) {
+            m_stats.hits++;
+            m_stats.bytesSaved += geometry->bytes;
+            return geometry;
+        }
+        m_byKey.erase(it); // 이미 해제됨
+    }
+
+    m_stats.misses++;
+
+    shared_ptr<const MeshGeometry> geometry = Upload(device, generate());
+    m_byKey[key] = geometry;
+
+    return geometry;
+}
+
+GeometryRegistry::Stats GeometryRegistry::GetStats() {
+    lock_guard<mutex> lock(m_mutex);
+    return m_stats;
+}
+
+} // namespace Moon
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <d3d11.h>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <wrl/client.h>
+
+#include "Mesh.h"
+#include "MeshData.h"
+#include "VertexPacker.h"
+
+namespace Moon {
+
+using Microsoft::WRL::ComPtr;
+
+// GPU에 올린 메쉬 하나의 지오메트리 (여러 Model의 Mesh가 공유 가능)
+// Mesh는 버퍼를 복사해서 쓰고 이 객체는 shared_ptr로 붙잡아 둠
+struct MeshGeometry {
+    ComPtr<ID3D11Buffer> vertexBuffer;
+    ComPtr<ID3D11Buffer> indexBuffer;
+
+    UINT indexCount = 0;
+    UINT vertexCount = 0;
+    UINT stride = 0;
+
+    // LOD별 인덱스 범위 ([0]은 전체)와 LOD0의 Meshlet들
+    std::shared_ptr<const std::vector<MeshLod>> lods;
+    std::shared_ptr<const std::vector<Meshlet>> meshlets;
+
+    MeshBounds bounds; // 모델 좌표계
+
+    bool isPacked = false; // PackedVertex로 저장했는지
+    PackingBounds packingBounds;
+
+    size_t bytes = 0; // 버텍스 + 인덱스 버퍼 크기
+};
+
+// 프로그램 전체에서 공유하는 절차적 지오메트리
+// (생성 함수 + 파라미터) 키로 MeshData를 만들고 올린 결과를 재사용
+// TextureCache처럼 weak_ptr로 들고 있으므로 쓰는 Mesh가 없으면 같이 해제
+
+class GeometryRegistry {
+  public:
+    struct Stats {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t bytesSaved = 0; // 다시 만들지 않아서 아낀 GPU 메모리
+    };
+
+    static GeometryRegistry &Get();
+
+    // 예: MakeKey("MakeSphere", {0.01f, 10.0f, 10.0f})
+    // 파라미터는 16진수 실수로 적으므로 값이 조금이라도 다르면 다른 키
+    // 만든 후에 바꾸는 처리(최적화, LOD 등)도 키를 이어 붙여서 구분
+    // 예: MakeKey("MakeSphere", {...}) + MakeKey("GenerateLods", ratios)
+    static std::string MakeKey(const std::string &generator,
+                               const std::vector<float> &params);
+
+    // MeshData를 버퍼로 올림 (packingBounds가 있으면 PackedVertex로)
+    // printStats: PackedVertex로 저장할 때 크기와 최대 오차 출력
+    static std::shared_ptr<MeshGeometry>
+    Upload(ComPtr<ID3D11Device> &device, const MeshData &meshData,
+           const PackingBounds *packingBounds = nullptr,
+           bool printStats = false);
+
+    // 키로 찾고 없으면 generate()로 만들어서 올린 후 등록
+    std::shared_ptr<const MeshGeometry>
+    GetOrCreate(ComPtr<ID3D11Device> &device, const std::string &key,
+                const std::function<MeshData()> &generate);
+
+    Stats GetStats();
+
+  private:
+    std::unordered_map<std::string, std::weak_ptr<const MeshGeometry>>
+        m_byKey;
+    std::mutex m_mutex;
+    Stats m_stats;
+};
+
+} // namespace Moon
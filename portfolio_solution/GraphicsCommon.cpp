@@ -14,6 +14,9 @@ ComPtr<ID3D11RasterizerState> solidRS;
 ComPtr<ID3D11RasterizerState> solidCCWRS;
 ComPtr<ID3D11RasterizerState> wireRS;
 ComPtr<ID3D11RasterizerState> wireCCWRS;
+ComPtr<ID3D11RasterizerState> solidScissorRS;
+ComPtr<ID3D11RasterizerState> solidCCWScissorRS;
+ComPtr<ID3D11RasterizerState> wireCCWScissorRS;
 ComPtr<ID3D11RasterizerState> postProcessingRS;
 
 // Depth Stencil States
@@ -31,6 +34,11 @@ ComPtr<ID3D11VertexShader> samplingVS;
 ComPtr<ID3D11VertexShader> normalVS;
 ComPtr<ID3D11VertexShader> depthOnlyVS;
 
+// PackedVertex용 (같은 쉐이더를 PACKED_VERTEX로 컴파일)
+ComPtr<ID3D11VertexShader> basicPackedVS;
+ComPtr<ID3D11VertexShader> normalPackedVS;
+ComPtr<ID3D11VertexShader> depthOnlyPackedVS;
+
 ComPtr<ID3D11PixelShader> basicPS;
 ComPtr<ID3D11PixelShader> skyboxPS;
 ComPtr<ID3D11PixelShader> combinePS;
@@ -47,6 +55,7 @@ ComPtr<ID3D11InputLayout> basicIL;
 ComPtr<ID3D11InputLayout> samplingIL;
 ComPtr<ID3D11InputLayout> skyboxIL;
 ComPtr<ID3D11InputLayout> postProcessingIL;
+ComPtr<ID3D11InputLayout> packedIL;
 
 // Graphics Pipeline States
 GraphicsPSO defaultSolidPSO;
@@ -123,6 +132,21 @@ void Graphics::InitRasterizerStates(ComPtr<ID3D11Device> &device) {
     ThrowIfFailed(
         device->CreateRasterizerState(&rastDesc, wireRS.GetAddressOf()));
 
+    // 거울 패스는 화면에서 거울이 차지하는 사각형 밖을 래스터화하지 않음
+    // (RSSetScissorRects()로 사각형을 설정한 후 사용)
+    rastDesc.ScissorEnable = true;
+    rastDesc.FrontCounterClockwise = true;
+    ThrowIfFailed(device->CreateRasterizerState(
+        &rastDesc, wireCCWScissorRS.GetAddressOf()));
+
+    rastDesc.FillMode = D3D11_FILL_MODE::D3D11_FILL_SOLID;
+    ThrowIfFailed(device->CreateRasterizerState(
+        &rastDesc, solidCCWScissorRS.GetAddressOf()));
+
+    rastDesc.FrontCounterClockwise = false;
+    ThrowIfFailed(device->CreateRasterizerState(
+        &rastDesc, solidScissorRS.GetAddressOf()));
+
     ZeroMemory(&rastDesc, sizeof(D3D11_RASTERIZER_DESC));
     rastDesc.FillMode = D3D11_FILL_MODE::D3D11_FILL_SOLID;
     rastDesc.CullMode = D3D11_CULL_MODE::D3D11_CULL_NONE;
@@ -274,6 +298,30 @@ void Graphics::InitShaders(ComPtr<ID3D11Device> &device) {
     D3D11Utils::CreateVertexShaderAndInputLayout(
         device, L"DepthOnlyVS.hlsl", basicIEs, depthOnlyVS, skyboxIL);
 
+    // PackedVertex (VertexPacker 참고)
+    vector<D3D11_INPUT_ELEMENT_DESC> packedIEs = {
+        {"POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, 0,
+         D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, 0, 8,
+         D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"TANGENT", 0, DXGI_FORMAT_R16G16_SNORM, 0, 12,
+         D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, 0, 16,
+         D3D11_INPUT_PER_VERTEX_DATA, 0},
+    };
+    const D3D_SHADER_MACRO packedDefines[] = {{"PACKED_VERTEX", "1"},
+                                              {nullptr, nullptr}};
+
+    D3D11Utils::CreateVertexShaderAndInputLayout(device, L"BasicVS.hlsl",
+                                                 packedIEs, basicPackedVS,
+                                                 packedIL, packedDefines);
+    D3D11Utils::CreateVertexShaderAndInputLayout(device, L"NormalVS.hlsl",
+                                                 packedIEs, normalPackedVS,
+                                                 packedIL, packedDefines);
+    D3D11Utils::CreateVertexShaderAndInputLayout(device, L"DepthOnlyVS.hlsl",
+                                                 packedIEs, depthOnlyPackedVS,
+                                                 packedIL, packedDefines);
+
     D3D11Utils::CreatePixelShader(device, L"BasicPS.hlsl", basicPS);
     D3D11Utils::CreatePixelShader(device, L"NormalPS.hlsl", normalPS);
     D3D11Utils::CreatePixelShader(device, L"SkyboxPS.hlsl", skyboxPS);
@@ -286,6 +334,19 @@ void Graphics::InitShaders(ComPtr<ID3D11Device> &device) {
     D3D11Utils::CreateGeometryShader(device, L"NormalGS.hlsl", normalGS);
 }
 
+ID3D11VertexShader *Graphics::GetPackedVertexShader(ID3D11VertexShader *vs) {
+    if (vs == basicVS.Get()) {
+        return basicPackedVS.Get();
+    }
+    if (vs == normalVS.Get()) {
+        return normalPackedVS.Get();
+    }
+    if (vs == depthOnlyVS.Get()) {
+        return depthOnlyPackedVS.Get();
+    }
+    return nullptr;
+}
+
 void Graphics::InitPipelineStates(ComPtr<ID3D11Device> &device) {
 
     // defaultSolidPSO;
@@ -302,6 +363,7 @@ void Graphics::InitPipelineStates(ComPtr<ID3D11Device> &device) {
     // stencilMarkPSO;
     stencilMaskPSO = defaultSolidPSO;
     stencilMaskPSO.m_depthStencilState = maskDSS;
+    stencilMaskPSO.m_rasterizerState = solidScissorRS;
     stencilMaskPSO.m_stencilRef = 1;
     stencilMaskPSO.m_vertexShader = depthOnlyVS;
     stencilMaskPSO.m_pixelShader = depthOnlyPS;
@@ -309,12 +371,12 @@ void Graphics::InitPipelineStates(ComPtr<ID3D11Device> &device) {
     // reflectSolidPSO: 반사되면 Winding 반대
     reflectSolidPSO = defaultSolidPSO;
     reflectSolidPSO.m_depthStencilState = drawMaskedDSS;
-    reflectSolidPSO.m_rasterizerState = solidCCWRS; // 반시계
+    reflectSolidPSO.m_rasterizerState = solidCCWScissorRS; // 반시계
     reflectSolidPSO.m_stencilRef = 1;
 
     // reflectWirePSO: 반사되면 Winding 반대
     reflectWirePSO = reflectSolidPSO;
-    reflectWirePSO.m_rasterizerState = wireCCWRS; // 반시계
+    reflectWirePSO.m_rasterizerState = wireCCWScissorRS; // 반시계
     reflectWirePSO.m_stencilRef = 1;
 
     // mirrorBlendSolidPSO;
@@ -342,12 +404,12 @@ void Graphics::InitPipelineStates(ComPtr<ID3D11Device> &device) {
     // reflectSkyboxSolidPSO
     reflectSkyboxSolidPSO = skyboxSolidPSO;
     reflectSkyboxSolidPSO.m_depthStencilState = drawMaskedDSS;
-    reflectSkyboxSolidPSO.m_rasterizerState = solidCCWRS; // 반시계
+    reflectSkyboxSolidPSO.m_rasterizerState = solidCCWScissorRS; // 반시계
     reflectSkyboxSolidPSO.m_stencilRef = 1;
 
     // reflectSkyboxWirePSO
     reflectSkyboxWirePSO = reflectSkyboxSolidPSO;
-    reflectSkyboxWirePSO.m_rasterizerState = wireCCWRS;
+    reflectSkyboxWirePSO.m_rasterizerState = wireCCWScissorRS;
     reflectSkyboxWirePSO.m_stencilRef = 1;
 
     // normalsPSO
@@ -20,6 +20,9 @@ extern ComPtr<ID3D11RasterizerState> solidRS;
 extern ComPtr<ID3D11RasterizerState> solidCCWRS; // Counter-ClockWise
 extern ComPtr<ID3D11RasterizerState> wireRS;
 extern ComPtr<ID3D11RasterizerState> wireCCWRS;
+extern ComPtr<ID3D11RasterizerState> solidScissorRS; // 거울 영역만
+extern ComPtr<ID3D11RasterizerState> solidCCWScissorRS;
+extern ComPtr<ID3D11RasterizerState> wireCCWScissorRS;
 extern ComPtr<ID3D11RasterizerState> postProcessingRS;
 
 // Depth Stencil States
@@ -33,6 +36,9 @@ extern ComPtr<ID3D11VertexShader> skyboxVS;
 extern ComPtr<ID3D11VertexShader> samplingVS;
 extern ComPtr<ID3D11VertexShader> normalVS;
 extern ComPtr<ID3D11VertexShader> depthOnlyVS;
+extern ComPtr<ID3D11VertexShader> basicPackedVS;
+extern ComPtr<ID3D11VertexShader> normalPackedVS;
+extern ComPtr<ID3D11VertexShader> depthOnlyPackedVS;
 extern ComPtr<ID3D11PixelShader> basicPS;
 extern ComPtr<ID3D11PixelShader> skyboxPS;
 extern ComPtr<ID3D11PixelShader> combinePS;
@@ -48,6 +54,7 @@ extern ComPtr<ID3D11InputLayout> basicIL;
 extern ComPtr<ID3D11InputLayout> samplingIL;
 extern ComPtr<ID3D11InputLayout> skyboxIL;
 extern ComPtr<ID3D11InputLayout> postProcessingIL;
+extern ComPtr<ID3D11InputLayout> packedIL;
 
 // Blend States
 extern ComPtr<ID3D11BlendState> mirrorBS;
@@ -78,6 +85,9 @@ void InitDepthStencilStates(ComPtr<ID3D11Device> &device);
 void InitPipelineStates(ComPtr<ID3D11Device> &device);
 void InitShaders(ComPtr<ID3D11Device> &device);
 
+// vs의 PackedVertex 버전 (없으면 nullptr)
+ID3D11VertexShader *GetPackedVertexShader(ID3D11VertexShader *vs);
+
 } // namespace Graphics
 
 } // namespace hlab
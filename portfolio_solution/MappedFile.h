@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <windows.h>
+
+namespace Moon {
+
+// 파일을 메모리에 매핑해서 읽기 전용으로 사용
+// (ReadFile로 복사하지 않고 OS 페이지 캐시를 그대로 사용)
+// https://learn.microsoft.com/en-us/windows/win32/memory/file-mapping
+
+class MappedFile {
+  public:
+    MappedFile() {}
+    ~MappedFile() { Close(); }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    bool Open(const std::string &filename);
+    void Close();
+
+    const uint8_t *Data() const { return m_data; }
+    size_t Size() const { return m_size; }
+    bool IsOpen() const { return m_data != nullptr; }
+
+  private:
+    HANDLE m_file = INVALID_HANDLE_VALUE;
+    HANDLE m_mapping = NULL;
+    const uint8_t *m_data = nullptr;
+    size_t m_size = 0;
+};
+
+// FNV-1a (8바이트 단위), 이어서 해시할 때는 앞의 결과를 hash로 전달
+// http://www.isthe.com/chongo/tech/comp/fnv/
+inline uint64_t HashBytes(const uint8_t *data, size_t size,
+                          uint64_t hash = 0xcbf29ce484222325ull) {
+
+    const uint64_t prime = 0x100000001b3ull;
+
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, data + i, 8);
+        hash = (hash ^ word) * prime;
+    }
+    for (; i < size; i++) {
+        hash = (hash ^ data[i]) * prime;
+    }
+
+    return hash;
+}
+
+} // namespace Moon
@@ -3,6 +3,7 @@
 #include <DirectXMath.h>
 #include <d3d11.h>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 #include <d3d11.h>
@@ -10,10 +11,21 @@
 #include <windows.h>
 #include <wrl/client.h>
 
+#include "MeshletBuilder.h"
+#include "TextureCache.h"
+
 namespace Moon {
 
 using Microsoft::WRL::ComPtr;
 
+struct MeshGeometry;
+
+// 인덱스 버퍼 안에서 LOD 하나의 범위
+struct MeshLod {
+    UINT indexCount = 0;
+    UINT startIndex = 0;
+};
+
 struct Mesh {
     // Mesh Constant
     // uint16_t Material Constant (`materialCBV)
@@ -39,10 +51,24 @@ struct Mesh {
     ComPtr<ID3D11ShaderResourceView> aoSRV;
     ComPtr<ID3D11ShaderResourceView> metallicRoughnessSRV;
 
+    // 버퍼들의 원본 (GeometryRegistry를 통해 다른 Mesh와 공유 가능)
+    std::shared_ptr<const MeshGeometry> geometry;
+
+    // TextureCache의 항목들 (다른 Mesh와 공유)
+    std::vector<std::shared_ptr<CachedTexture>> textures;
+
     UINT indexCount = 0; // Number of indices = 3 * number of triangles
     UINT vertexCount = 0;
     UINT stride = 0;
     UINT offset = 0;
+
+    // LOD별 인덱스 범위 ([0]은 전체), 모든 LOD가 같은 버퍼를 사용
+    // 범위와 Meshlet은 MeshGeometry와 공유하므로 복사하지 않음
+    std::shared_ptr<const std::vector<MeshLod>> lods;
+
+    // LOD0을 나눈 Meshlet들(없으면 nullptr)과 컬링 후 남은 인덱스 범위
+    std::shared_ptr<const std::vector<Meshlet>> meshlets;
+    std::vector<IndexRange> visibleRanges;
 };
 
 } // namespace hlab
@@ -0,0 +1,415 @@
+#include "MeshCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#include "MappedFile.h"
+#include "MeshCodec.h"
+#include "ThreadPool.h"
+
+namespace Moon {
+
+using namespace std;
+
+namespace {
+
+const uint32_t CACHE_MAGIC = 0x4853454D; // "MESH"
+
+// 포맷이나 MeshData를 만드는 과정이 바뀌면 버전을 올려서 예전 캐시를 무효화
+const uint32_t CACHE_VERSION = 11;
+
+struct SourceKey {
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    uint64_t hash = 0;
+};
+
+struct Header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t vertexSize; // sizeof(Vertex)가 바뀌어도 무효
+    uint32_t revertNormals;
+    uint64_t numSources; // 원본 파일 개수 (첫 번째는 filename)
+    uint64_t numMeshes;
+    uint64_t optionsHash; // 로더, 용접, 최적화, 배칭, LOD 옵션
+};
+
+// 압축 블록 하나의 원소 개수와 압축한 크기
+// 크기를 미리 적어두므로 읽을 때 블록들의 위치를 알고 동시에 풀 수 있음
+struct BlockHeader {
+    uint64_t count;
+    uint64_t numBytes;
+};
+
+struct MeshHeader {
+    BlockHeader vertices;
+    BlockHeader indices;
+    uint64_t numLods; // LOD0 제외
+    MeshBounds bounds;
+};
+
+// 파일에 저장하는 블록 순서: 메쉬마다 버텍스, 인덱스, LOD 인덱스들
+struct BlockRef {
+    size_t mesh;
+    int lod; // -1이면 버텍스, 0이면 indices, 1 이상이면 lodIndices[lod - 1]
+};
+
+vector<BlockRef> ListBlocks(const vector<MeshData> &meshes) {
+    vector<BlockRef> blocks;
+    for (size_t i = 0; i < meshes.size(); i++) {
+        for (int lod = -1; lod <= int(meshes[i].lodIndices.size()); lod++) {
+            blocks.push_back({i, lod});
+        }
+    }
+    return blocks;
+}
+
+vector<uint32_t> &IndicesOf(MeshData &mesh, int lod) {
+    return lod == 0 ? mesh.indices : mesh.lodIndices[lod - 1];
+}
+
+const vector<uint32_t> &IndicesOf(const MeshData &mesh, int lod) {
+    return lod == 0 ? mesh.indices : mesh.lodIndices[lod - 1];
+}
+
+// 캐시에 저장하는 텍스춰 파일 이름들 (순서 고정)
+string MeshData::*const textureFilenames[] = {
+    &MeshData::albedoTextureFilename,    &MeshData::emissiveTextureFilename,
+    &MeshData::normalTextureFilename,    &MeshData::heightTextureFilename,
+    &MeshData::aoTextureFilename,        &MeshData::metallicTextureFilename,
+    &MeshData::roughnessTextureFilename,
+};
+
+// 파일을 열지 않고 크기와 수정 시간만 (hash는 그대로 둠)
+bool GetFileStat(const string &path, SourceKey &key) {
+
+    error_code ec;
+    const auto size = filesystem::file_size(path, ec);
+    if (ec) {
+        return false;
+    }
+    const auto mtime = filesystem::last_write_time(path, ec);
+    if (ec) {
+        return false;
+    }
+
+    key.size = uint64_t(size);
+    key.mtime = int64_t(mtime.time_since_epoch().count());
+
+    return true;
+}
+
+bool GetSourceKey(const string &path, SourceKey &key) {
+
+    if (!GetFileStat(path, key)) {
+        return false;
+    }
+
+    MappedFile file;
+    if (!file.Open(path)) {
+        return false;
+    }
+
+    key.size = file.Size();
+    key.hash = HashBytes(file.Data(), file.Size());
+
+    return true;
+}
+
+// [경로 길이, 경로, SourceKey] x numSources를 읽으면서 지금 파일과 비교
+bool CheckSources(const uint8_t *&ptr, const uint8_t *end,
+                  uint64_t numSources) {
+
+    for (uint64_t i = 0; i < numSources; i++) {
+        uint32_t length;
+        if (size_t(end - ptr) < sizeof(length)) {
+            return false;
+        }
+        memcpy(&length, ptr, sizeof(length));
+        ptr += sizeof(length);
+
+        if (size_t(end - ptr) < size_t(length) + sizeof(SourceKey)) {
+            return false;
+        }
+        const string path((const char *)ptr, length);
+        ptr += length;
+
+        SourceKey stored, key;
+        memcpy(&stored, ptr, sizeof(SourceKey));
+        ptr += sizeof(SourceKey);
+
+        // 크기와 수정 시간이 같으면 내용을 읽지 않음
+        // 다를 때만 해시를 비교 (내용은 같고 수정 시간만 바뀐 경우)
+        if (!GetFileStat(path, key)) {
+            return false;
+        }
+        if (stored.size == key.size && stored.mtime == key.mtime) {
+            continue;
+        }
+        if (!GetSourceKey(path, key) || stored.size != key.size ||
+            stored.hash != key.hash) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+string MeshCache::GetCacheFilename(const string &basePath,
+                                   const string &filename) {
+    return basePath + filename + ".meshcache";
+}
+
+bool MeshCache::Read(const string &basePath, const string &filename,
+                     bool revertNormals, uint64_t optionsHash,
+                     vector<MeshData> &meshes) {
+
+    MappedFile file;
+    if (!file.Open(GetCacheFilename(basePath, filename))) {
+        return false;
+    }
+
+    const uint8_t *ptr = file.Data();
+    const uint8_t *end = file.Data() + file.Size();
+
+    if (size_t(end - ptr) < sizeof(Header)) {
+        return false;
+    }
+
+    Header header;
+    memcpy(&header, ptr, sizeof(Header));
+    ptr += sizeof(Header);
+
+    if (header.magic != CACHE_MAGIC || header.version != CACHE_VERSION ||
+        header.vertexSize != sizeof(Vertex) ||
+        header.revertNormals != uint32_t(revertNormals) ||
+        header.optionsHash != optionsHash || header.numSources == 0) {
+        return false; // 오래된 캐시
+    }
+
+    // 원본 파일 중 하나라도 바뀌었으면 다시 만듦 (.gltf가 참조하는 .bin 등)
+    if (!CheckSources(ptr, end, header.numSources)) {
+        return false;
+    }
+
+    if (header.numMeshes > size_t(end - ptr) / sizeof(MeshHeader)) {
+        return false;
+    }
+
+    vector<MeshHeader> meshHeaders(header.numMeshes);
+    if (header.numMeshes > 0) {
+        memcpy(meshHeaders.data(), ptr,
+               sizeof(MeshHeader) * meshHeaders.size());
+        ptr += sizeof(MeshHeader) * meshHeaders.size();
+    }
+
+    // LOD 블록 헤더들 (메쉬 순서대로 이어서 저장)
+    size_t numLods = 0;
+    for (const auto &m : meshHeaders) {
+        if (m.numLods > size_t(end - ptr) / sizeof(BlockHeader) - numLods) {
+            return false;
+        }
+        numLods += m.numLods;
+    }
+    vector<BlockHeader> lodHeaders(numLods);
+    if (numLods > 0) {
+        memcpy(lodHeaders.data(), ptr, sizeof(BlockHeader) * numLods);
+        ptr += sizeof(BlockHeader) * numLods;
+    }
+
+    vector<MeshData> newMeshes(header.numMeshes);
+    vector<BlockHeader> blockHeaders;
+    blockHeaders.reserve(newMeshes.size() * 2 + numLods);
+    const BlockHeader *lodHeader = lodHeaders.data();
+    for (size_t i = 0; i < newMeshes.size(); i++) {
+        const MeshHeader &m = meshHeaders[i];
+        newMeshes[i].bounds = m.bounds;
+        newMeshes[i].lodIndices.resize(m.numLods);
+        blockHeaders.push_back(m.vertices);
+        blockHeaders.push_back(m.indices);
+        blockHeaders.insert(blockHeaders.end(), lodHeader,
+                            lodHeader + m.numLods);
+        lodHeader += m.numLods;
+    }
+
+    // 블록들의 시작 위치를 구한 후 작업 스레드에서 동시에 디코딩
+    const vector<BlockRef> blocks = ListBlocks(newMeshes);
+    vector<const uint8_t *> blockData(blocks.size());
+    for (size_t b = 0; b < blocks.size(); b++) {
+        if (blockHeaders[b].numBytes > size_t(end - ptr)) {
+            return false;
+        }
+        blockData[b] = ptr;
+        ptr += blockHeaders[b].numBytes;
+    }
+
+    vector<uint8_t> decoded(blocks.size(), 0);
+    ThreadPool::Get().ParallelFor(blocks.size(), [&](size_t b) {
+        MeshData &mesh = newMeshes[blocks[b].mesh];
+        const BlockHeader &h = blockHeaders[b];
+        const uint8_t *blockPtr = blockData[b];
+        const uint8_t *blockEnd = blockData[b] + h.numBytes;
+        const bool ok =
+            blocks[b].lod < 0
+                ? MeshCodec::DecodeVertices(blockPtr, blockEnd, h.count,
+                                            mesh.vertices)
+                : MeshCodec::DecodeIndices(blockPtr, blockEnd, h.count,
+                                           IndicesOf(mesh, blocks[b].lod));
+        decoded[b] = ok && blockPtr == blockEnd;
+    });
+    if (find(decoded.begin(), decoded.end(), 0) != decoded.end()) {
+        return false;
+    }
+
+    for (auto &mesh : newMeshes) {
+        for (auto member : textureFilenames) {
+            uint32_t length;
+            if (size_t(end - ptr) < sizeof(length)) {
+                return false;
+            }
+            memcpy(&length, ptr, sizeof(length));
+            ptr += sizeof(length);
+
+            if (size_t(end - ptr) < length) {
+                return false;
+            }
+            (mesh.*member).assign((const char *)ptr, length);
+            ptr += length;
+        }
+    }
+
+    meshes = std::move(newMeshes);
+
+    return true;
+}
+
+void MeshCache::Write(const string &basePath, const string &filename,
+                      bool revertNormals, uint64_t optionsHash,
+                      const vector<MeshData> &meshes,
+                      const vector<string> &sourceFiles, bool printStats) {
+
+    // filename을 맨 앞에 두고 중복 제거 (Assimp는 같은 파일을 여러 번 열기도)
+    vector<string> sources = {basePath + filename};
+    for (const auto &path : sourceFiles) {
+        if (find(sources.begin(), sources.end(), path) == sources.end()) {
+            sources.push_back(path);
+        }
+    }
+    vector<SourceKey> keys(sources.size());
+    for (size_t i = 0; i < sources.size(); i++) {
+        if (!GetSourceKey(sources[i], keys[i])) {
+            return;
+        }
+    }
+
+    Header header = {};
+    header.magic = CACHE_MAGIC;
+    header.version = CACHE_VERSION;
+    header.vertexSize = sizeof(Vertex);
+    header.revertNormals = uint32_t(revertNormals);
+    header.numSources = sources.size();
+    header.numMeshes = meshes.size();
+    header.optionsHash = optionsHash;
+
+    // 쓰는 도중에 종료되어도 깨진 캐시가 남지 않도록
+    // 임시 파일에 다 쓴 다음 이름을 바꿈
+    const string cacheFilename = GetCacheFilename(basePath, filename);
+    const string tempFilename = cacheFilename + ".tmp";
+
+    {
+        ofstream out(tempFilename, ios::binary | ios::trunc);
+        if (!out) {
+            cout << "Failed to write mesh cache: " << cacheFilename << endl;
+            return;
+        }
+
+        out.write((const char *)&header, sizeof(header));
+
+        for (size_t i = 0; i < sources.size(); i++) {
+            const uint32_t length = uint32_t(sources[i].size());
+            out.write((const char *)&length, sizeof(length));
+            out.write(sources[i].data(), length);
+            out.write((const char *)&keys[i], sizeof(SourceKey));
+        }
+
+        // 블록마다 따로 압축 (작업 스레드에서 동시에)
+        const vector<BlockRef> blocks = ListBlocks(meshes);
+        vector<vector<uint8_t>> encoded(blocks.size());
+        ThreadPool::Get().ParallelFor(blocks.size(), [&](size_t b) {
+            const MeshData &mesh = meshes[blocks[b].mesh];
+            if (blocks[b].lod < 0) {
+                MeshCodec::EncodeVertices(mesh.vertices, encoded[b]);
+            } else {
+                MeshCodec::EncodeIndices(IndicesOf(mesh, blocks[b].lod),
+                                         encoded[b]);
+            }
+        });
+
+        size_t b = 0;
+        for (const auto &mesh : meshes) {
+            MeshHeader m;
+            m.vertices = {mesh.vertices.size(), encoded[b].size()};
+            m.indices = {mesh.indices.size(), encoded[b + 1].size()};
+            m.numLods = mesh.lodIndices.size();
+            m.bounds = mesh.bounds;
+            out.write((const char *)&m, sizeof(m));
+            b += 2 + mesh.lodIndices.size();
+        }
+
+        b = 0;
+        for (const auto &mesh : meshes) {
+            b += 2;
+            for (const auto &lod : mesh.lodIndices) {
+                const BlockHeader h = {lod.size(), encoded[b++].size()};
+                out.write((const char *)&h, sizeof(h));
+            }
+        }
+
+        size_t rawBytes = 0, encodedBytes = 0;
+        for (size_t i = 0; i < blocks.size(); i++) {
+            out.write((const char *)encoded[i].data(), encoded[i].size());
+            encodedBytes += encoded[i].size();
+        }
+        for (const auto &mesh : meshes) {
+            rawBytes += sizeof(Vertex) * mesh.vertices.size() +
+                        sizeof(uint32_t) * mesh.indices.size();
+            for (const auto &lod : mesh.lodIndices) {
+                rawBytes += sizeof(uint32_t) * lod.size();
+            }
+        }
+        if (printStats) {
+            cout << "Mesh cache: " << rawBytes / 1024 << " KB -> "
+                 << encodedBytes / 1024 << " KB" << endl;
+        }
+
+        for (const auto &mesh : meshes) {
+            for (auto member : textureFilenames) {
+                const string &name = mesh.*member;
+                const uint32_t length = uint32_t(name.size());
+                out.write((const char *)&length, sizeof(length));
+                out.write(name.data(), length);
+            }
+        }
+
+        if (!out) {
+            cout << "Failed to write mesh cache: " << cacheFilename << endl;
+            out.close();
+            filesystem::remove(tempFilename);
+            return;
+        }
+    }
+
+    error_code ec;
+    filesystem::rename(tempFilename, cacheFilename, ec);
+    if (ec) {
+        cout << "Failed to write mesh cache: " << cacheFilename << endl;
+        filesystem::remove(tempFilename, ec);
+    }
+}
+
+} // namespace Moon
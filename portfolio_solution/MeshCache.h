@@ -0,0 +1,45 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "MeshData.h"
+
+namespace Moon {
+
+// ReadFromFile() 결과(정규화, 탄젠트 계산까지 끝난 MeshData)를
+// 바이너리 파일로 저장해두고 다음 실행부터는 메모리 매핑으로 바로 읽음
+
+// 파일 구조
+// [Header] [원본 파일 (길이 + 경로 + 크기/수정 시간/해시) x numSources]
+// [MeshHeader x numMeshes] [LOD 블록 헤더 x 모든 메쉬의 numLods 합]
+// [Vertex 블록, 인덱스 블록, LOD 인덱스 블록 x numLods] x numMeshes
+//   (블록들은 MeshCodec으로 압축, 헤더에 압축한 크기가 있으므로
+//    블록들을 작업 스레드에서 동시에 풀 수 있음)
+// [텍스춰 파일 이름 테이블 (길이 + 문자열) x 7 x numMeshes]
+
+// 원본 파일들(filename과 로더가 연 .bin, .mtl 등)의 크기/수정 시간/해시,
+// revertNormals, 처리 옵션의 해시, 포맷 버전이 하나라도 다르면
+// 캐시를 무시하고 다시 만듦
+// 원본 파일은 크기와 수정 시간이 그대로면 해시를 다시 계산하지 않음
+
+class MeshCache {
+  public:
+    // optionsHash: MeshData를 만들 때 사용한 옵션들의 해시
+    static bool Read(const std::string &basePath, const std::string &filename,
+                     bool revertNormals, uint64_t optionsHash,
+                     std::vector<MeshData> &meshes);
+
+    // sourceFiles: 로더가 읽은 파일들 (ModelLoader::sourceFiles)
+    // printStats: 압축 전후 크기 출력
+    static void Write(const std::string &basePath, const std::string &filename,
+                      bool revertNormals, uint64_t optionsHash,
+                      const std::vector<MeshData> &meshes,
+                      const std::vector<std::string> &sourceFiles,
+                      bool printStats = false);
+
+    static std::string GetCacheFilename(const std::string &basePath,
+                                        const std::string &filename);
+};
+
+} // namespace Moon
@@ -0,0 +1,272 @@
+#include "MeshCodec.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <emmintrin.h>
+
+namespace Moon {
+
+using namespace std;
+
+namespace {
+
+const size_t BLOCK_SIZE = 16; // 블록 하나의 바이트 수 (SSE 레지스터 하나)
+
+static_assert(sizeof(Vertex) % 4 == 0, "Vertex must be 32-bit words");
+
+size_t NumBlocks(size_t count) { return (count + BLOCK_SIZE - 1) / BLOCK_SIZE; }
+
+uint32_t ZigZag(uint32_t delta) {
+    return (delta << 1) ^ uint32_t(-int32_t(delta >> 31));
+}
+
+// 블록 하나 (16바이트)를 width비트만큼 비트 평면으로 저장
+// 비트 j인 평면은 16개 바이트의 j번째 비트 (2바이트)
+void PackBlock(const uint8_t *block, int width, vector<uint8_t> &out) {
+    const __m128i v = _mm_loadu_si128((const __m128i *)block);
+    if (width == 8) {
+        out.insert(out.end(), block, block + BLOCK_SIZE);
+        return;
+    }
+    for (int j = 0; j < width; j++) {
+        // 각 바이트의 비트 j를 최상위 비트로 옮긴 후 모음
+        const int mask =
+            _mm_movemask_epi8(_mm_sll_epi64(v, _mm_cvtsi32_si128(7 - j)));
+        out.push_back(uint8_t(mask));
+        out.push_back(uint8_t(mask >> 8));
+    }
+}
+
+// 바이트 b의 비트 i를 i번째 바이트의 최하위 비트로 펼친 값 (8바이트)
+constexpr array<uint64_t, 256> MakeSpreadTable() {
+    array<uint64_t, 256> table = {};
+    for (uint32_t b = 0; b < 256; b++) {
+        for (uint32_t i = 0; i < 8; i++) {
+            table[b] |= uint64_t((b >> i) & 1) << (8 * i);
+        }
+    }
+    return table;
+}
+
+const array<uint64_t, 256> spreadTable = MakeSpreadTable();
+
+// PackBlock()의 역, src에서 2 * width바이트 (width가 8이면 16바이트)를 읽음
+// 비트 평면 하나(2바이트)를 표로 펼쳐서 바이트마다 1 << j로 합침
+// (바이트마다 0 또는 1이므로 64비트로 시프트해도 이웃 바이트로 넘어가지 않음)
+__m128i UnpackBlock(const uint8_t *src, int width) {
+    if (width == 8) {
+        return _mm_loadu_si128((const __m128i *)src);
+    }
+
+    uint64_t lo = 0, hi = 0;
+    for (int j = 0; j < width; j++) {
+        lo |= spreadTable[src[0]] << j;
+        hi |= spreadTable[src[1]] << j;
+        src += 2;
+    }
+    return _mm_set_epi64x(int64_t(hi), int64_t(lo));
+}
+
+// 원소 numElements개 x 32비트 워드 numWords개
+// [평면 0의 블록 비트 수] [평면 0의 블록들] [평면 1 ...] ... 순서로 저장
+void EncodeWords(const uint8_t *data, size_t numElements, size_t numWords,
+                 vector<uint8_t> &out) {
+
+    const size_t numBlocks = NumBlocks(numElements);
+    const size_t stride = numWords * 4;
+
+    vector<uint8_t> planes(numWords * 4 * numBlocks * BLOCK_SIZE, 0);
+    const size_t planeSize = numBlocks * BLOCK_SIZE;
+
+    for (size_t k = 0; k < numWords; k++) {
+        uint32_t prev = 0;
+        for (size_t e = 0; e < numElements; e++) {
+            uint32_t word;
+            memcpy(&word, data + e * stride + k * 4, 4);
+            const uint32_t z = ZigZag(word - prev);
+            prev = word;
+            for (size_t b = 0; b < 4; b++) {
+                planes[(k * 4 + b) * planeSize + e] = uint8_t(z >> (8 * b));
+            }
+        }
+    }
+
+    for (size_t p = 0; p < numWords * 4; p++) {
+        const uint8_t *plane = planes.data() + p * planeSize;
+
+        // 블록마다 필요한 비트 수
+        vector<uint8_t> widths(numBlocks);
+        for (size_t i = 0; i < numBlocks; i++) {
+            uint8_t maxValue = 0;
+            for (size_t j = 0; j < BLOCK_SIZE; j++) {
+                maxValue |= plane[i * BLOCK_SIZE + j];
+            }
+            int width = 0;
+            while (width < 8 && (maxValue >> width)) {
+                width++;
+            }
+            widths[i] = uint8_t(width);
+        }
+
+        for (size_t i = 0; i < numBlocks; i += 2) {
+            const uint8_t hi = i + 1 < numBlocks ? widths[i + 1] : 0;
+            out.push_back(uint8_t(widths[i] | (hi << 4)));
+        }
+        for (size_t i = 0; i < numBlocks; i++) {
+            PackBlock(plane + i * BLOCK_SIZE, widths[i], out);
+        }
+    }
+}
+
+int BlockWidth(const uint8_t *widths, size_t block) {
+    return (widths[block / 2] >> (4 * (block % 2))) & 0xf;
+}
+
+// 평면마다 블록 2개당 비트 수 1바이트는 있어야 하므로
+// 남은 데이터로 불가능한 개수면 메모리를 잡기 전에 거름
+bool IsPossible(const uint8_t *ptr, const uint8_t *end, size_t numElements,
+                size_t numWords) {
+    return (NumBlocks(numElements) + 1) / 2 <=
+           size_t(end - ptr) / (numWords * 4);
+}
+
+size_t PackedSize(int width) {
+    return width == 8 ? BLOCK_SIZE : size_t(width) * 2;
+}
+
+bool DecodeWords(const uint8_t *&ptr, const uint8_t *end, size_t numElements,
+                 size_t numWords, uint8_t *data) {
+
+    const size_t numBlocks = NumBlocks(numElements);
+    const size_t numWidthBytes = (numBlocks + 1) / 2;
+    const size_t numPlanes = numWords * 4;
+    const size_t stride = numWords * 4;
+
+    // 1. 평면마다 블록 비트 수와 데이터 시작 위치를 찾고 크기 검사
+    vector<const uint8_t *> widths(numPlanes);
+    vector<const uint8_t *> cursors(numPlanes);
+    for (size_t p = 0; p < numPlanes; p++) {
+        if (size_t(end - ptr) < numWidthBytes) {
+            return false;
+        }
+        widths[p] = ptr;
+        ptr += numWidthBytes;
+
+        size_t size = 0;
+        for (size_t i = 0; i < numBlocks; i++) {
+            const int width = BlockWidth(widths[p], i);
+            if (width > 8) {
+                return false;
+            }
+            size += PackedSize(width);
+        }
+        if (size_t(end - ptr) < size) {
+            return false;
+        }
+        cursors[p] = ptr;
+        ptr += size;
+    }
+
+    // 2. 블록(원소 16개)마다 워드별로 평면 4개를 풀어서 합치고
+    //    zigzag를 푼 후 누적 합, 원소 순서로 모아서 씀
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi32(1);
+    vector<__m128i> carries(numWords, zero);
+    vector<uint32_t> words(numWords * BLOCK_SIZE);
+
+    for (size_t i = 0; i < numBlocks; i++) {
+        for (size_t k = 0; k < numWords; k++) {
+            __m128i b[4];
+            for (size_t j = 0; j < 4; j++) {
+                const size_t p = k * 4 + j;
+                const int width = BlockWidth(widths[p], i);
+                b[j] = UnpackBlock(cursors[p], width);
+                cursors[p] += PackedSize(width);
+            }
+
+            const __m128i lo01 = _mm_unpacklo_epi8(b[0], b[1]);
+            const __m128i hi01 = _mm_unpackhi_epi8(b[0], b[1]);
+            const __m128i lo23 = _mm_unpacklo_epi8(b[2], b[3]);
+            const __m128i hi23 = _mm_unpackhi_epi8(b[2], b[3]);
+            const __m128i w[4] = {
+                _mm_unpacklo_epi16(lo01, lo23), _mm_unpackhi_epi16(lo01, lo23),
+                _mm_unpacklo_epi16(hi01, hi23), _mm_unpackhi_epi16(hi01, hi23)};
+
+            __m128i carry = carries[k];
+            for (int q = 0; q < 4; q++) {
+                // (z >> 1) ^ -(z & 1)
+                const __m128i sign =
+                    _mm_sub_epi32(zero, _mm_and_si128(w[q], one));
+                __m128i x = _mm_xor_si128(_mm_srli_epi32(w[q], 1), sign);
+
+                // 레지스터 안의 누적 합 + 앞 레지스터의 마지막 값
+                x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+                x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+                x = _mm_add_epi32(x, carry);
+                carry = _mm_shuffle_epi32(x, 0xff);
+                _mm_storeu_si128(
+                    (__m128i *)(words.data() + k * BLOCK_SIZE + 4 * q), x);
+            }
+            carries[k] = carry;
+        }
+
+        const size_t first = i * BLOCK_SIZE;
+        const size_t count = std::min(BLOCK_SIZE, numElements - first);
+        if (numWords == 1 && count == BLOCK_SIZE) {
+            // 가변 크기 memcpy() 호출 없이 바로 씀
+            for (size_t q = 0; q < 4; q++) {
+                _mm_storeu_si128(
+                    (__m128i *)(data + first * 4) + q,
+                    _mm_loadu_si128((const __m128i *)words.data() + q));
+            }
+            continue;
+        }
+        if (numWords == 1) {
+            memcpy(data + first * 4, words.data(), count * 4);
+            continue;
+        }
+        for (size_t e = 0; e < count; e++) {
+            uint8_t *element = data + (first + e) * stride;
+            for (size_t k = 0; k < numWords; k++) {
+                memcpy(element + k * 4, &words[k * BLOCK_SIZE + e], 4);
+            }
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+void MeshCodec::EncodeVertices(const vector<Vertex> &vertices,
+                               vector<uint8_t> &out) {
+    EncodeWords((const uint8_t *)vertices.data(), vertices.size(),
+                sizeof(Vertex) / 4, out);
+}
+
+void MeshCodec::EncodeIndices(const vector<uint32_t> &indices,
+                              vector<uint8_t> &out) {
+    EncodeWords((const uint8_t *)indices.data(), indices.size(), 1, out);
+}
+
+bool MeshCodec::DecodeVertices(const uint8_t *&ptr, const uint8_t *end,
+                               size_t numVertices, vector<Vertex> &vertices) {
+    if (!IsPossible(ptr, end, numVertices, sizeof(Vertex) / 4)) {
+        return false;
+    }
+    vertices.resize(numVertices);
+    return DecodeWords(ptr, end, numVertices, sizeof(Vertex) / 4,
+                       (uint8_t *)vertices.data());
+}
+
+bool MeshCodec::DecodeIndices(const uint8_t *&ptr, const uint8_t *end,
+                              size_t numIndices, vector<uint32_t> &indices) {
+    if (!IsPossible(ptr, end, numIndices, 1)) {
+        return false;
+    }
+    indices.resize(numIndices);
+    return DecodeWords(ptr, end, numIndices, 1, (uint8_t *)indices.data());
+}
+
+} // namespace Moon
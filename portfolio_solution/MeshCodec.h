@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Vertex.h"
+
+namespace Moon {
+
+// MeshCache에 저장하는 버텍스/인덱스 스트림의 무손실 압축
+// 1. 32비트 단위로 앞 원소의 같은 위치 값과의 차이를 zigzag로 부호 없는 값으로
+//    (인덱스는 삼각형 순서대로 앞 인덱스와의 차이)
+// 2. 같은 바이트 위치끼리 모아서 바이트 평면으로 전치 (상위 바이트는 거의 0)
+// 3. 평면을 16바이트 블록으로 나누고 블록의 최대값이 필요한 비트 수(0~8)만큼만
+//    비트 평면으로 저장 (블록 비트 수는 4비트씩)
+// 디코딩은 SSE2로 블록 16개 원소를 한 번에 풀고 누적 합도 벡터로 계산
+// 참고: Fabian Giesen "Byte plane transposition"
+// https://fgiesen.wordpress.com/2011/01/24/x86-code-compression-in-kkrunchy/
+// 참고: Lemire and Boytsov "Decoding billions of integers per second"
+// https://arxiv.org/abs/1209.2137
+
+class MeshCodec {
+  public:
+    // out 뒤에 이어서 씀
+    static void EncodeVertices(const std::vector<Vertex> &vertices,
+                               std::vector<uint8_t> &out);
+
+    static void EncodeIndices(const std::vector<uint32_t> &indices,
+                              std::vector<uint8_t> &out);
+
+    // ptr에서 numVertices개를 읽고 ptr을 그 뒤로 옮김
+    // 데이터가 모자라거나 깨졌으면 false
+    static bool DecodeVertices(const uint8_t *&ptr, const uint8_t *end,
+                               size_t numVertices,
+                               std::vector<Vertex> &vertices);
+
+    static bool DecodeIndices(const uint8_t *&ptr, const uint8_t *end,
+                              size_t numIndices,
+                              std::vector<uint32_t> &indices);
+};
+
+} // namespace Moon
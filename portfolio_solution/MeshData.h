@@ -6,6 +6,7 @@
 #include <string>
 #include <vector>
 
+#include "BoundsBuilder.h"
 #include "Vertex.h"
 
 namespace Moon {
@@ -22,6 +23,12 @@ struct MeshData {
     std::string aoTextureFilename; // Ambient Occlusion
     std::string metallicTextureFilename;
     std::string roughnessTextureFilename;
+
+    // LOD1부터의 인덱스 (LOD0는 indices), 버텍스는 모두 같이 사용
+    std::vector<std::vector<uint32_t>> lodIndices;
+
+    // 모델 좌표계의 바운딩 볼륨 (파일에서 읽은 메쉬는 임포트할 때 계산)
+    MeshBounds bounds;
 };
 
 } // namespace hlab
\ No newline at end of file
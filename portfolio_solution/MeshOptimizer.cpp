@@ -0,0 +1,397 @@
+#include "MeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace Moon {
+
+using namespace std;
+using DirectX::SimpleMath::Vector3;
+
+namespace {
+
+// Forsyth 알고리즘에서 사용하는 LRU 캐시 크기와 점수
+const int FORSYTH_CACHE_SIZE = 32;
+const float CACHE_DECAY_POWER = 1.5f;
+const float LAST_TRI_SCORE = 0.75f;
+const float VALENCE_BOOST_SCALE = 2.0f;
+const float VALENCE_BOOST_POWER = 0.5f;
+
+float VertexScore(int cachePosition, uint32_t remainingTriangles) {
+
+    if (remainingTriangles == 0) {
+        return -1.0f; // 더 이상 사용되지 않는 버텍스
+    }
+
+    float score = 0.0f;
+    if (cachePosition >= 0) {
+        if (cachePosition < 3) {
+            // 바로 직전 삼각형에 사용된 버텍스들은 일부러 낮은 점수
+            score = LAST_TRI_SCORE;
+        } else {
+            const float scaler = 1.0f / (FORSYTH_CACHE_SIZE - 3);
+            score = powf(1.0f - (cachePosition - 3) * scaler,
+                         CACHE_DECAY_POWER);
+        }
+    }
+
+    // 남은 삼각형이 적은 버텍스를 먼저 처리해서 외톨이 삼각형이 생기지 않도록
+    score += VALENCE_BOOST_SCALE *
+             powf(float(remainingTriangles), -VALENCE_BOOST_POWER);
+
+    return score;
+}
+
+// FIFO 캐시 시뮬레이션 (타임스탬프 방식)
+class FifoCache {
+  public:
+    FifoCache(size_t numVertices, int cacheSize)
+        : m_timestamps(numVertices, 0), m_cacheSize(uint32_t(cacheSize)),
+          m_time(uint32_t(cacheSize) + 1) {}
+
+    // 미스이면 true
+    bool Access(uint32_t v) {
+        if (m_time - m_timestamps[v] > m_cacheSize) {
+            m_timestamps[v] = m_time++;
+            return true;
+        }
+        return false;
+    }
+
+    void Reset() { m_time += m_cacheSize + 1; }
+
+  private:
+    vector<uint32_t> m_timestamps;
+    uint32_t m_cacheSize;
+    uint32_t m_time;
+};
+
+} // namespace
+
+VertexCacheStats
+MeshOptimizer::AnalyzeVertexCache(const vector<uint32_t> &indices,
+                                  size_t numVertices, int fifoCacheSize) {
+
+    VertexCacheStats stats;
+    if (indices.size() < 3 || numVertices == 0) {
+        return stats;
+    }
+
+    FifoCache cache(numVertices, fifoCacheSize);
+    vector<bool> used(numVertices, false);
+
+    size_t misses = 0;
+    size_t numUsed = 0;
+    for (const auto i : indices) {
+        misses += cache.Access(i) ? 1 : 0;
+        if (!used[i]) {
+            used[i] = true;
+            numUsed++;
+        }
+    }
+
+    stats.acmr = float(misses) / float(indices.size() / 3);
+    stats.atvr = float(misses) / float(numUsed);
+
+    return stats;
+}
+
+void MeshOptimizer::OptimizeVertexCache(vector<uint32_t> &indices,
+                                        size_t numVertices) {
+
+    const size_t numTriangles = indices.size() / 3;
+    if (numTriangles < 2 || numVertices == 0) {
+        return;
+    }
+
+    // 버텍스마다 인접한 삼각형 목록 (CSR 형식)
+    vector<uint32_t> remaining(numVertices, 0);
+    for (const auto i : indices) {
+        remaining[i]++;
+    }
+
+    vector<uint32_t> offsets(numVertices + 1, 0);
+    for (size_t v = 0; v < numVertices; v++) {
+        offsets[v + 1] = offsets[v] + remaining[v];
+    }
+
+    vector<uint32_t> adjacency(indices.size());
+    {
+        vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+        for (size_t t = 0; t < numTriangles; t++) {
+            for (size_t k = 0; k < 3; k++) {
+                const uint32_t v = indices[t * 3 + k];
+                adjacency[fill[v]++] = uint32_t(t);
+            }
+        }
+    }
+
+    vector<int> cachePosition(numVertices, -1);
+    vector<float> vertexScores(numVertices);
+    for (size_t v = 0; v < numVertices; v++) {
+        vertexScores[v] = VertexScore(-1, remaining[v]);
+    }
+
+    vector<bool> emitted(numTriangles, false);
+
+    vector<uint32_t> cache, newCache;
+    cache.reserve(FORSYTH_CACHE_SIZE + 3);
+    newCache.reserve(FORSYTH_CACHE_SIZE + 3);
+
+    vector<uint32_t> result;
+    result.reserve(indices.size());
+
+    size_t cursor = 0; // 아직 출력하지 않은 첫 삼각형을 찾기 위한 위치
+    int64_t best = -1;
+
+    for (size_t count = 0; count < numTriangles; count++) {
+
+        // 캐시 근처에 후보가 없으면 출력하지 않은 다음 삼각형
+        if (best < 0) {
+            while (emitted[cursor]) {
+                cursor++;
+            }
+            best = int64_t(cursor);
+        }
+
+        const uint32_t *tri = &indices[size_t(best) * 3];
+        result.insert(result.end(), tri, tri + 3);
+        emitted[size_t(best)] = true;
+
+        // 사용한 삼각형을 인접 목록에서 제거
+        for (size_t k = 0; k < 3; k++) {
+            const uint32_t v = tri[k];
+            uint32_t *begin = &adjacency[offsets[v]];
+            uint32_t *end = begin + remaining[v];
+            uint32_t *it = find(begin, end, uint32_t(best));
+            swap(*it, *(end - 1));
+            remaining[v]--;
+        }
+
+        // 방금 사용한 버텍스들을 캐시 앞쪽으로
+        newCache.assign(tri, tri + 3);
+        for (const auto v : cache) {
+            if (v != tri[0] && v != tri[1] && v != tri[2]) {
+                newCache.push_back(v);
+            }
+        }
+
+        // 캐시에서 밀려난 버텍스들
+        for (size_t i = FORSYTH_CACHE_SIZE; i < newCache.size(); i++) {
+            const uint32_t v = newCache[i];
+            cachePosition[v] = -1;
+            vertexScores[v] = VertexScore(-1, remaining[v]);
+        }
+        newCache.resize(min(newCache.size(), size_t(FORSYTH_CACHE_SIZE)));
+
+        for (size_t i = 0; i < newCache.size(); i++) {
+            const uint32_t v = newCache[i];
+            cachePosition[v] = int(i);
+            vertexScores[v] = VertexScore(int(i), remaining[v]);
+        }
+
+        swap(cache, newCache);
+
+        // 캐시 안 버텍스들에 인접한 삼각형들만 점수를 다시 계산하고
+        // 그 중에서 다음 삼각형 선택
+        best = -1;
+        float bestScore = -1.0f;
+        for (const auto v : cache) {
+            for (uint32_t a = 0; a < remaining[v]; a++) {
+                const uint32_t t = adjacency[offsets[v] + a];
+                const float score = vertexScores[indices[t * 3]] +
+                                    vertexScores[indices[t * 3 + 1]] +
+                                    vertexScores[indices[t * 3 + 2]];
+                if (score > bestScore) {
+                    bestScore = score;
+                    best = t;
+                }
+            }
+        }
+    }
+
+    indices = std::move(result);
+}
+
+void MeshOptimizer::OptimizeOverdraw(vector<uint32_t> &indices,
+                                     const vector<Vertex> &vertices,
+                                     float threshold, int fifoCacheSize) {
+
+    const size_t numTriangles = indices.size() / 3;
+    if (numTriangles < 2) {
+        return;
+    }
+
+    FifoCache cache(vertices.size(), fifoCacheSize);
+
+    // 1. 캐시가 완전히 비워지는 곳(세 버텍스 모두 미스)에서 나누기
+    vector<size_t> hardBoundaries;
+    for (size_t t = 0; t < numTriangles; t++) {
+        int misses = 0;
+        for (size_t k = 0; k < 3; k++) {
+            misses += cache.Access(indices[t * 3 + k]) ? 1 : 0;
+        }
+        if (t == 0 || misses == 3) {
+            hardBoundaries.push_back(t);
+        }
+    }
+    hardBoundaries.push_back(numTriangles);
+
+    // 2. 각 클러스터 안에서 ACMR이 크게 나빠지지 않는 범위에서 더 잘게 나누기
+    vector<size_t> clusters;
+    for (size_t c = 0; c + 1 < hardBoundaries.size(); c++) {
+        const size_t begin = hardBoundaries[c];
+        const size_t end = hardBoundaries[c + 1];
+
+        cache.Reset();
+        size_t clusterMisses = 0;
+        for (size_t i = begin * 3; i < end * 3; i++) {
+            clusterMisses += cache.Access(indices[i]) ? 1 : 0;
+        }
+        const float limit =
+            float(clusterMisses) / float(end - begin) * threshold;
+
+        cache.Reset();
+        size_t start = begin;
+        size_t misses = 0;
+        clusters.push_back(begin);
+        for (size_t t = begin; t < end; t++) {
+            for (size_t k = 0; k < 3; k++) {
+                misses += cache.Access(indices[t * 3 + k]) ? 1 : 0;
+            }
+            if (t + 1 < end && float(misses) / float(t + 1 - start) <= limit) {
+                // 캐시를 비운 상태로 새 클러스터 시작
+                clusters.push_back(t + 1);
+                start = t + 1;
+                misses = 0;
+                cache.Reset();
+            }
+        }
+    }
+    clusters.push_back(numTriangles);
+
+    // 3. 메쉬 중심에서 바깥을 향하는 정도로 클러스터 정렬
+    Vector3 meshCentroid(0.0f);
+    float meshArea = 0.0f;
+    for (size_t t = 0; t < numTriangles; t++) {
+        const Vector3 &p0 = vertices[indices[t * 3]].position;
+        const Vector3 &p1 = vertices[indices[t * 3 + 1]].position;
+        const Vector3 &p2 = vertices[indices[t * 3 + 2]].position;
+        const float area = (p1 - p0).Cross(p2 - p0).Length();
+        meshCentroid += (p0 + p1 + p2) * (area / 3.0f);
+        meshArea += area;
+    }
+    if (meshArea > 0.0f) {
+        meshCentroid /= meshArea;
+    }
+
+    const size_t numClusters = clusters.size() - 1;
+    vector<float> sortKeys(numClusters);
+    for (size_t c = 0; c < numClusters; c++) {
+        Vector3 centroid(0.0f);
+        Vector3 normal(0.0f);
+        float area = 0.0f;
+        for (size_t t = clusters[c]; t < clusters[c + 1]; t++) {
+            const Vector3 &p0 = vertices[indices[t * 3]].position;
+            const Vector3 &p1 = vertices[indices[t * 3 + 1]].position;
+            const Vector3 &p2 = vertices[indices[t * 3 + 2]].position;
+            const Vector3 n = (p1 - p0).Cross(p2 - p0); // 길이 = 넓이 * 2
+            const float a = n.Length();
+            centroid += (p0 + p1 + p2) * (a / 3.0f);
+            normal += n;
+            area += a;
+        }
+        if (area > 0.0f) {
+            centroid /= area;
+        }
+        normal.Normalize();
+        sortKeys[c] = (centroid - meshCentroid).Dot(normal);
+    }
+
+    vector<size_t> order(numClusters);
+    for (size_t c = 0; c < numClusters; c++) {
+        order[c] = c;
+    }
+    stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return sortKeys[a] > sortKeys[b];
+    });
+
+    vector<uint32_t> result;
+    result.reserve(indices.size());
+    for (const auto c : order) {
+        result.insert(result.end(), indices.begin() + clusters[c] * 3,
+                      indices.begin() + clusters[c + 1] * 3);
+    }
+
+    indices = std::move(result);
+}
+
+void MeshOptimizer::OptimizeVertexFetch(MeshData &meshData) {
+
+    auto &vertices = meshData.vertices;
+    auto &indices = meshData.indices;
+
+    const uint32_t none = uint32_t(-1);
+    vector<uint32_t> remap(vertices.size(), none);
+
+    vector<Vertex> newVertices;
+    newVertices.reserve(vertices.size());
+
+    // 인덱스 버퍼에서 처음 나오는 순서대로
+    for (auto &i : indices) {
+        if (remap[i] == none) {
+            remap[i] = uint32_t(newVertices.size());
+            newVertices.push_back(vertices[i]);
+        }
+        i = remap[i];
+    }
+
+    // 사용되지 않는 버텍스는 뒤에 그대로 둠
+    for (size_t v = 0; v < vertices.size(); v++) {
+        if (remap[v] == none) {
+            newVertices.push_back(vertices[v]);
+        }
+    }
+
+    vertices = std::move(newVertices);
+}
+
+void MeshOptimizer::Optimize(MeshData &meshData,
+                             const MeshOptimizeOptions &options) {
+
+    if (meshData.indices.size() < 6) {
+        return;
+    }
+
+    const auto before =
+        AnalyzeVertexCache(meshData.indices, meshData.vertices.size(),
+                           options.fifoCacheSize);
+
+    OptimizeVertexCache(meshData.indices, meshData.vertices.size());
+
+    if (options.optimizeOverdraw) {
+        OptimizeOverdraw(meshData.indices, meshData.vertices,
+                         options.overdrawThreshold, options.fifoCacheSize);
+    }
+
+    OptimizeVertexFetch(meshData);
+
+    if (options.printStats) {
+        const auto after =
+            AnalyzeVertexCache(meshData.indices, meshData.vertices.size(),
+                               options.fifoCacheSize);
+        cout << "Optimize mesh (" << meshData.indices.size() / 3
+             << " triangles) ACMR " << before.acmr << " -> " << after.acmr
+             << ", ATVR " << before.atvr << " -> " << after.atvr << endl;
+    }
+}
+
+void MeshOptimizer::Optimize(vector<MeshData> &meshes,
+                             const MeshOptimizeOptions &options) {
+    for (auto &mesh : meshes) {
+        Optimize(mesh, options);
+    }
+}
+
+} // namespace Moon
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "MeshData.h"
+
+namespace Moon {
+
+// GPU에 올리기 전에 인덱스/버텍스 순서를 바꿔서 캐시 효율을 높임
+// 1. Post-transform 버텍스 캐시: Forsyth 알고리즘
+//    https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html
+// 2. Overdraw: 캐시 순서를 유지하는 클러스터 단위로 나눈 후
+//    바깥을 향하는 클러스터부터 그리도록 정렬 (시점 무관)
+//    Sander et al. "Fast Triangle Reordering for Vertex Locality and
+//    Reduced Overdraw" (2007)
+// 3. Vertex fetch: 처음 사용되는 순서대로 버텍스 재배치
+
+struct MeshOptimizeOptions {
+    bool optimizeOverdraw = true;
+    float overdrawThreshold = 1.05f; // 허용하는 ACMR 증가 비율
+    int fifoCacheSize = 16; // ACMR/ATVR 측정에 사용하는 FIFO 캐시 크기
+    bool printStats = false; // 전후 ACMR/ATVR 출력
+};
+
+struct VertexCacheStats {
+    float acmr = 0.0f; // Average Cache Miss Ratio (삼각형당 미스)
+    float atvr = 0.0f; // Average Transform to Vertex Ratio (버텍스당 미스)
+};
+
+class MeshOptimizer {
+  public:
+    static void Optimize(MeshData &meshData,
+                         const MeshOptimizeOptions &options =
+                             MeshOptimizeOptions());
+
+    static void Optimize(std::vector<MeshData> &meshes,
+                         const MeshOptimizeOptions &options =
+                             MeshOptimizeOptions());
+
+    static void OptimizeVertexCache(std::vector<uint32_t> &indices,
+                                    size_t numVertices);
+
+    static void OptimizeOverdraw(std::vector<uint32_t> &indices,
+                                 const std::vector<Vertex> &vertices,
+                                 float threshold, int fifoCacheSize);
+
+    static void OptimizeVertexFetch(MeshData &meshData);
+
+    static VertexCacheStats
+    AnalyzeVertexCache(const std::vector<uint32_t> &indices,
+                       size_t numVertices, int fifoCacheSize);
+};
+
+} // namespace Moon
@@ -0,0 +1,419 @@
+#include "MeshSimplifier.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+#include <iostream>
+#include <queue>
+#include <unordered_map>
+
+#include "MeshOptimizer.h"
+
+namespace Moon {
+
+using namespace std;
+using DirectX::SimpleMath::Vector3;
+
+namespace {
+
+// 대칭 4x4 행렬 (평면까지 거리의 제곱 합)
+struct Quadric {
+    double a2 = 0, ab = 0, ac = 0, ad = 0;
+    double b2 = 0, bc = 0, bd = 0;
+    double c2 = 0, cd = 0;
+    double d2 = 0;
+
+    void AddPlane(const Vector3 &n, double d, double weight) {
+        const double a = n.x, b = n.y, c = n.z;
+        a2 += weight * a * a;
+        ab += weight * a * b;
+        ac += weight * a * c;
+        ad += weight * a * d;
+        b2 += weight * b * b;
+        bc += weight * b * c;
+        bd += weight * b * d;
+        c2 += weight * c * c;
+        cd += weight * c * d;
+        d2 += weight * d * d;
+    }
+
+    void operator+=(const Quadric &q) {
+        a2 += q.a2, ab += q.ab, ac += q.ac, ad += q.ad;
+        b2 += q.b2, bc += q.bc, bd += q.bd;
+        c2 += q.c2, cd += q.cd;
+        d2 += q.d2;
+    }
+
+    double Evaluate(const Vector3 &p) const {
+        const double x = p.x, y = p.y, z = p.z;
+        return a2 * x * x + 2 * ab * x * y + 2 * ac * x * z + 2 * ad * x +
+               b2 * y * y + 2 * bc * y * z + 2 * bd * y + c2 * z * z +
+               2 * cd * z + d2;
+    }
+};
+
+struct Collapse {
+    double cost;
+    uint32_t from;
+    uint32_t to;
+    uint32_t version;
+
+    bool operator>(const Collapse &other) const { return cost > other.cost; }
+};
+
+class Simplifier {
+  public:
+    Simplifier(const vector<Vertex> &vertices, const vector<uint32_t> &indices,
+               const SimplifyOptions &options)
+        : m_vertices(vertices), m_options(options) {
+
+        const size_t numVertices = vertices.size();
+        const size_t numTriangles = indices.size() / 3;
+
+        m_triangles.assign(indices.begin(), indices.begin() + numTriangles * 3);
+        m_alive.assign(numTriangles, true);
+        m_vertexTriangles.resize(numVertices);
+        m_quadrics.resize(numVertices);
+        m_locked.assign(numVertices, false);
+        m_removed.assign(numVertices, false);
+        m_versions.assign(numVertices, 0);
+
+        // 메쉬 크기 (노멀 비용의 단위를 맞추기 위함)
+        Vector3 vmin(FLT_MAX), vmax(-FLT_MAX);
+        for (const auto &v : vertices) {
+            vmin = Vector3::Min(vmin, v.position);
+            vmax = Vector3::Max(vmax, v.position);
+        }
+        const double extent =
+            numVertices > 0 ? double((vmax - vmin).Length()) : 0.0;
+        m_normalWeight = double(options.normalWeight) * extent * extent;
+
+        m_numAlive = 0;
+        for (size_t t = 0; t < numTriangles; t++) {
+            const uint32_t i0 = m_triangles[t * 3];
+            const uint32_t i1 = m_triangles[t * 3 + 1];
+            const uint32_t i2 = m_triangles[t * 3 + 2];
+            if (i0 == i1 || i1 == i2 || i2 == i0) {
+                m_alive[t] = false; // 이미 퇴화된 삼각형
+                continue;
+            }
+            m_numAlive++;
+
+            const Vector3 &p0 = vertices[i0].position;
+            const Vector3 &p1 = vertices[i1].position;
+            const Vector3 &p2 = vertices[i2].position;
+            Vector3 n = (p1 - p0).Cross(p2 - p0);
+            const double area = double(n.Length()) * 0.5;
+            if (area <= 0.0) {
+                continue;
+            }
+            n.Normalize();
+            const double d = -double(n.Dot(p0));
+
+            for (size_t k = 0; k < 3; k++) {
+                const uint32_t v = m_triangles[t * 3 + k];
+                m_quadrics[v].AddPlane(n, d, area);
+                m_vertexTriangles[v].push_back(uint32_t(t));
+            }
+        }
+
+        LockSeamsAndBorders();
+    }
+
+    void Run(size_t targetTriangles) {
+
+        for (uint32_t v = 0; v < uint32_t(m_vertices.size()); v++) {
+            PushBestCollapse(v);
+        }
+
+        while (m_numAlive > targetTriangles && !m_queue.empty()) {
+            const Collapse c = m_queue.top();
+            m_queue.pop();
+
+            if (m_removed[c.from] || m_removed[c.to] ||
+                m_versions[c.from] != c.version) {
+                continue; // 주변이 바뀌어서 더 이상 유효하지 않음
+            }
+
+            DoCollapse(c.from, c.to);
+        }
+    }
+
+    vector<uint32_t> GetIndices() const {
+        vector<uint32_t> indices;
+        indices.reserve(m_numAlive * 3);
+        for (size_t t = 0; t < m_alive.size(); t++) {
+            if (m_alive[t]) {
+                indices.insert(indices.end(), &m_triangles[t * 3],
+                               &m_triangles[t * 3] + 3);
+            }
+        }
+        return indices;
+    }
+
+  private:
+    void LockSeamsAndBorders() {
+
+        // 위치가 같은 버텍스들을 하나로 묶음
+        unordered_map<uint64_t, uint32_t> firstAtPosition;
+        vector<uint32_t> positionId(m_vertices.size());
+        vector<uint32_t> numAtPosition;
+
+        for (size_t v = 0; v < m_vertices.size(); v++) {
+            const Vector3 &p = m_vertices[v].position;
+            uint32_t bits[3];
+            memcpy(bits, &p.x, sizeof(bits));
+            const uint64_t key = (uint64_t(bits[0]) * 73856093ull) ^
+                                 (uint64_t(bits[1]) * 19349663ull << 16) ^
+                                 (uint64_t(bits[2]) * 83492791ull << 32);
+
+            // 해시 충돌은 위치를 직접 비교해서 확인
+            auto it = firstAtPosition.find(key);
+            if (it != firstAtPosition.end() &&
+                m_vertices[it->second].position == p) {
+                positionId[v] = positionId[it->second];
+                numAtPosition[positionId[v]]++;
+            } else {
+                positionId[v] = uint32_t(numAtPosition.size());
+                numAtPosition.push_back(1);
+                if (it == firstAtPosition.end()) {
+                    firstAtPosition[key] = uint32_t(v);
+                }
+            }
+        }
+
+        // 1. UV 이음매: 같은 위치에 버텍스가 여러 개
+        if (m_options.lockSeams) {
+            for (size_t v = 0; v < m_vertices.size(); v++) {
+                if (numAtPosition[positionId[v]] > 1) {
+                    m_locked[v] = true;
+                }
+            }
+        }
+
+        // 2. 열린 경계: 위치 기준으로 한 삼각형에만 속한 모서리
+        if (m_options.lockBorders) {
+            unordered_map<uint64_t, uint32_t> edgeCount;
+            edgeCount.reserve(m_numAlive * 3);
+            for (size_t t = 0; t < m_alive.size(); t++) {
+                if (!m_alive[t]) {
+                    continue;
+                }
+                for (size_t k = 0; k < 3; k++) {
+                    uint64_t a = positionId[m_triangles[t * 3 + k]];
+                    uint64_t b = positionId[m_triangles[t * 3 + (k + 1) % 3]];
+                    if (a > b) {
+                        swap(a, b);
+                    }
+                    edgeCount[(a << 32) | b]++;
+                }
+            }
+
+            vector<bool> borderPosition(numAtPosition.size(), false);
+            for (const auto &e : edgeCount) {
+                if (e.second == 1) {
+                    borderPosition[e.first >> 32] = true;
+                    borderPosition[e.first & 0xffffffffull] = true;
+                }
+            }
+            for (size_t v = 0; v < m_vertices.size(); v++) {
+                if (borderPosition[positionId[v]]) {
+                    m_locked[v] = true;
+                }
+            }
+        }
+    }
+
+    // from을 to 위치로 옮겼을 때 뒤집히는 삼각형이 있는지
+    bool FlipsTriangle(uint32_t from, uint32_t to) const {
+        const Vector3 &newPos = m_vertices[to].position;
+        for (const auto t : m_vertexTriangles[from]) {
+            if (!m_alive[t]) {
+                continue;
+            }
+            const uint32_t *tri = &m_triangles[t * 3];
+            if (tri[0] == to || tri[1] == to || tri[2] == to) {
+                continue; // 없어질 삼각형
+            }
+
+            Vector3 p[3], q[3];
+            for (size_t k = 0; k < 3; k++) {
+                p[k] = m_vertices[tri[k]].position;
+                q[k] = tri[k] == from ? newPos : p[k];
+            }
+            const Vector3 before = (p[1] - p[0]).Cross(p[2] - p[0]);
+            const Vector3 after = (q[1] - q[0]).Cross(q[2] - q[0]);
+            if (before.Dot(after) <= 0.0f) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    double Cost(uint32_t from, uint32_t to) const {
+        Quadric q = m_quadrics[from];
+        q += m_quadrics[to];
+        const double normalDiff =
+            1.0 - double(m_vertices[from].normalModel.Dot(
+                      m_vertices[to].normalModel));
+        return max(q.Evaluate(m_vertices[to].position), 0.0) +
+               m_normalWeight * normalDiff;
+    }
+
+    void PushBestCollapse(uint32_t from) {
+
+        if (m_locked[from] || m_removed[from]) {
+            return;
+        }
+
+        double bestCost = DBL_MAX;
+        uint32_t best = uint32_t(-1);
+
+        for (const auto t : m_vertexTriangles[from]) {
+            if (!m_alive[t]) {
+                continue;
+            }
+            for (size_t k = 0; k < 3; k++) {
+                const uint32_t to = m_triangles[t * 3 + k];
+                if (to == from) {
+                    continue;
+                }
+                const double cost = Cost(from, to);
+                if (cost < bestCost && !FlipsTriangle(from, to)) {
+                    bestCost = cost;
+                    best = to;
+                }
+            }
+        }
+
+        if (best != uint32_t(-1)) {
+            m_queue.push({bestCost, from, best, m_versions[from]});
+        }
+    }
+
+    void DoCollapse(uint32_t from, uint32_t to) {
+
+        for (const auto t : m_vertexTriangles[from]) {
+            if (!m_alive[t]) {
+                continue;
+            }
+            uint32_t *tri = &m_triangles[t * 3];
+            if (tri[0] == to || tri[1] == to || tri[2] == to) {
+                m_alive[t] = false; // 모서리가 없어지면서 같이 없어짐
+                m_numAlive--;
+            } else {
+                for (size_t k = 0; k < 3; k++) {
+                    if (tri[k] == from) {
+                        tri[k] = to;
+                    }
+                }
+                m_vertexTriangles[to].push_back(t);
+            }
+        }
+
+        m_quadrics[to] += m_quadrics[from];
+        m_removed[from] = true;
+        m_vertexTriangles[from].clear();
+
+        // 죽은 삼각형 정리
+        auto &toTriangles = m_vertexTriangles[to];
+        toTriangles.erase(remove_if(toTriangles.begin(), toTriangles.end(),
+                                    [&](uint32_t t) { return !m_alive[t]; }),
+                          toTriangles.end());
+
+        // to 주변 버텍스들의 후보를 다시 계산
+        m_neighbors.clear();
+        m_neighbors.push_back(to);
+        for (const auto t : toTriangles) {
+            for (size_t k = 0; k < 3; k++) {
+                m_neighbors.push_back(m_triangles[t * 3 + k]);
+            }
+        }
+        sort(m_neighbors.begin(), m_neighbors.end());
+        m_neighbors.erase(unique(m_neighbors.begin(), m_neighbors.end()),
+                          m_neighbors.end());
+
+        for (const auto v : m_neighbors) {
+            m_versions[v]++;
+            PushBestCollapse(v);
+        }
+    }
+
+    const vector<Vertex> &m_vertices;
+    const SimplifyOptions &m_options;
+    double m_normalWeight = 0.0;
+
+    vector<uint32_t> m_triangles;
+    vector<bool> m_alive;
+    size_t m_numAlive = 0;
+
+    vector<vector<uint32_t>> m_vertexTriangles;
+    vector<Quadric> m_quadrics;
+    vector<bool> m_locked;
+    vector<bool> m_removed;
+    vector<uint32_t> m_versions;
+    vector<uint32_t> m_neighbors;
+
+    priority_queue<Collapse, vector<Collapse>, greater<Collapse>> m_queue;
+};
+
+} // namespace
+
+vector<uint32_t> MeshSimplifier::Simplify(const vector<Vertex> &vertices,
+                                          const vector<uint32_t> &indices,
+                                          size_t targetTriangles,
+                                          const SimplifyOptions &options) {
+
+    Simplifier simplifier(vertices, indices, options);
+    simplifier.Run(targetTriangles);
+
+    vector<uint32_t> result = simplifier.GetIndices();
+    MeshOptimizer::OptimizeVertexCache(result, vertices.size());
+
+    return result;
+}
+
+void MeshSimplifier::GenerateLods(MeshData &meshData,
+                                  const LodOptions &options) {
+
+    meshData.lodIndices.clear();
+    meshData.lodIndices.reserve(options.ratios.size());
+
+    const size_t numTriangles = meshData.indices.size() / 3;
+    const vector<uint32_t> *prev = &meshData.indices;
+
+    for (const auto ratio : options.ratios) {
+        const size_t target = size_t(float(numTriangles) * ratio);
+        if (target < options.minTriangles) {
+            break;
+        }
+
+        // 바로 앞 LOD에서 시작하면 더 빠름
+        auto lod = Simplify(meshData.vertices, *prev, target, options.simplify);
+
+        // 잠긴 버텍스가 많아서 거의 줄지 않으면 중단
+        if (lod.size() * 10 > prev->size() * 9) {
+            break;
+        }
+
+        meshData.lodIndices.push_back(std::move(lod));
+        prev = &meshData.lodIndices.back();
+    }
+
+    if (options.printStats) {
+        cout << "LOD triangles " << numTriangles;
+        for (const auto &lod : meshData.lodIndices) {
+            cout << " -> " << lod.size() / 3;
+        }
+        cout << endl;
+    }
+}
+
+void MeshSimplifier::GenerateLods(vector<MeshData> &meshes,
+                                  const LodOptions &options) {
+    for (auto &mesh : meshes) {
+        GenerateLods(mesh, options);
+    }
+}
+
+} // namespace Moon
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "MeshData.h"
+
+namespace Moon {
+
+// Quadric Error Metric으로 삼각형 개수를 줄인 LOD 인덱스를 만듦
+// Garland and Heckbert, "Surface Simplification Using Quadric Error Metrics"
+// https://www.cs.cmu.edu/~./garland/Papers/quadrics.pdf
+
+// 버텍스를 새로 만들지 않고 기존 버텍스로 합치는 방식(half-edge collapse)이므로
+// 모든 LOD가 버텍스 버퍼 하나를 같이 사용함
+// UV 이음매(같은 위치에 다른 버텍스)와 열린 경계의 버텍스는 움직이지 않고
+// 노멀 차이가 큰 방향으로 합치는 것은 비용을 높여서 노멀을 보존
+
+struct SimplifyOptions {
+    float normalWeight = 0.1f; // 노멀 차이 비용 (메쉬 크기^2 기준)
+    bool lockSeams = true;
+    bool lockBorders = true;
+};
+
+struct LodOptions {
+    std::vector<float> ratios = {0.5f, 0.25f, 0.125f}; // LOD0 대비 삼각형 비율
+    size_t minTriangles = 32; // 이보다 적으면 더 만들지 않음
+    SimplifyOptions simplify;
+    bool printStats = false;
+};
+
+class MeshSimplifier {
+  public:
+    // targetTriangles 이하가 될 때까지 (또는 더 합칠 수 없을 때까지) 단순화
+    static std::vector<uint32_t> Simplify(const std::vector<Vertex> &vertices,
+                                          const std::vector<uint32_t> &indices,
+                                          size_t targetTriangles,
+                                          const SimplifyOptions &options =
+                                              SimplifyOptions());
+
+    // meshData.lodIndices를 채움 (LOD0는 meshData.indices)
+    static void GenerateLods(MeshData &meshData,
+                             const LodOptions &options = LodOptions());
+
+    static void GenerateLods(std::vector<MeshData> &meshes,
+                             const LodOptions &options = LodOptions());
+};
+
+} // namespace Moon
@@ -0,0 +1,312 @@
+#include "MeshletBuilder.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <iostream>
+
+#include "Camera.h"
+
+namespace Moon {
+
+using namespace std;
+using DirectX::SimpleMath::Matrix;
+using DirectX::SimpleMath::Vector3;
+using DirectX::SimpleMath::Vector4;
+
+namespace {
+
+void ComputeBounds(const vector<Vertex> &vertices,
+                   const vector<uint32_t> &indices, Meshlet &meshlet) {
+
+    // 바운딩 스피어: AABB 중심에서 가장 먼 버텍스까지
+    Vector3 vmin(FLT_MAX), vmax(-FLT_MAX);
+    for (uint32_t i = 0; i < meshlet.indexCount; i++) {
+        const Vector3 &p = vertices[indices[meshlet.startIndex + i]].position;
+        vmin = Vector3::Min(vmin, p);
+        vmax = Vector3::Max(vmax, p);
+    }
+    meshlet.center = (vmin + vmax) * 0.5f;
+    meshlet.radius = 0.0f;
+    for (uint32_t i = 0; i < meshlet.indexCount; i++) {
+        const Vector3 &p = vertices[indices[meshlet.startIndex + i]].position;
+        meshlet.radius = max(meshlet.radius, (p - meshlet.center).Length());
+    }
+
+    // 노멀 콘: 삼각형 노멀들의 평균 방향과 가장 많이 벗어난 노멀
+    vector<Vector3> normals;
+    normals.reserve(meshlet.indexCount / 3);
+    Vector3 axis(0.0f);
+    for (uint32_t i = 0; i < meshlet.indexCount; i += 3) {
+        const uint32_t *tri = &indices[meshlet.startIndex + i];
+        const Vector3 &p0 = vertices[tri[0]].position;
+        Vector3 n = (vertices[tri[1]].position - p0)
+                        .Cross(vertices[tri[2]].position - p0);
+        const float length = n.Length();
+        if (length > 1e-12f) { // 면적이 0인 삼각형은 무시
+            n /= length;
+            normals.push_back(n);
+            axis += n;
+        }
+    }
+
+    meshlet.coneAxis = Vector3(0.0f);
+    meshlet.coneCutoff = 1.0f;
+
+    const float axisLength = axis.Length();
+    if (normals.empty() || axisLength < 1e-6f) {
+        return;
+    }
+    axis /= axisLength;
+
+    float minDot = 1.0f;
+    for (const auto &n : normals) {
+        minDot = min(minDot, n.Dot(axis));
+    }
+
+    // 노멀들이 너무 넓게 퍼져 있으면 뒷면이 될 일이 거의 없음
+    if (minDot <= 0.1f) {
+        return;
+    }
+
+    meshlet.coneAxis = axis;
+    meshlet.coneCutoff = sqrtf(1.0f - minDot * minDot);
+}
+
+} // namespace
+
+void MeshletBuilder::Build(const vector<Vertex> &vertices,
+                           vector<uint32_t> &indices, vector<Meshlet> &meshlets,
+                           const MeshletOptions &options) {
+
+    meshlets.clear();
+
+    const size_t numTriangles = indices.size() / 3;
+    if (numTriangles == 0) {
+        return;
+    }
+
+    // 버텍스 -> 삼각형 인접 리스트 (CSR)
+    vector<uint32_t> adjacencyOffsets(vertices.size() + 1, 0);
+    for (const auto i : indices) {
+        adjacencyOffsets[i + 1]++;
+    }
+    for (size_t v = 0; v < vertices.size(); v++) {
+        adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+    }
+    vector<uint32_t> adjacency(indices.size());
+    {
+        vector<uint32_t> fill(adjacencyOffsets.begin(),
+                              adjacencyOffsets.end() - 1);
+        for (size_t t = 0; t < numTriangles; t++) {
+            for (int k = 0; k < 3; k++) {
+                adjacency[fill[indices[t * 3 + k]]++] = uint32_t(t);
+            }
+        }
+    }
+
+    vector<Vector3> triNormals(numTriangles);
+    for (size_t t = 0; t < numTriangles; t++) {
+        const Vector3 &p0 = vertices[indices[t * 3]].position;
+        Vector3 n = (vertices[indices[t * 3 + 1]].position - p0)
+                        .Cross(vertices[indices[t * 3 + 2]].position - p0);
+        n.Normalize();
+        triNormals[t] = n;
+    }
+
+    vector<bool> used(numTriangles, false);
+    vector<uint32_t> vertexStamp(vertices.size(), UINT32_MAX);
+
+    vector<uint32_t> newIndices;
+    newIndices.reserve(indices.size());
+
+    vector<uint32_t> meshletTriangles;
+    vector<uint32_t> candidates;
+    size_t seedCursor = 0;
+    size_t totalVertices = 0;
+
+    // 새 삼각형이 추가하는 버텍스 개수
+    auto countNewVertices = [&](uint32_t t, uint32_t stamp) {
+        int count = 0;
+        for (int k = 0; k < 3; k++) {
+            count += vertexStamp[indices[t * 3 + k]] != stamp;
+        }
+        return count;
+    };
+
+    while (true) {
+        while (seedCursor < numTriangles && used[seedCursor]) {
+            seedCursor++;
+        }
+        if (seedCursor == numTriangles) {
+            break;
+        }
+
+        const uint32_t stamp = uint32_t(meshlets.size());
+        size_t numVertices = 0;
+        Vector3 normalSum(0.0f);
+        meshletTriangles.clear();
+        candidates.clear();
+
+        uint32_t next = uint32_t(seedCursor);
+        while (true) {
+            // 삼각형 추가
+            used[next] = true;
+            meshletTriangles.push_back(next);
+            normalSum += triNormals[next];
+            for (int k = 0; k < 3; k++) {
+                const uint32_t v = indices[next * 3 + k];
+                if (vertexStamp[v] == stamp) {
+                    continue;
+                }
+                vertexStamp[v] = stamp;
+                numVertices++;
+                for (uint32_t a = adjacencyOffsets[v];
+                     a < adjacencyOffsets[v + 1]; a++) {
+                    if (!used[adjacency[a]]) {
+                        candidates.push_back(adjacency[a]);
+                    }
+                }
+            }
+
+            if (meshletTriangles.size() >= options.maxTriangles) {
+                break;
+            }
+
+            // 이웃 삼각형 중에서 새 버텍스가 적고 노멀이 비슷한 것을 선택
+            Vector3 axis = normalSum;
+            axis.Normalize();
+
+            int best = -1;
+            float bestScore = FLT_MAX;
+            for (size_t c = 0; c < candidates.size();) {
+                const uint32_t t = candidates[c];
+                if (used[t]) {
+                    candidates[c] = candidates.back();
+                    candidates.pop_back();
+                    continue;
+                }
+
+                const int newVertices = countNewVertices(t, stamp);
+                if (numVertices + newVertices <= options.maxVertices) {
+                    const float score =
+                        float(newVertices) +
+                        options.coneWeight * (1.0f - triNormals[t].Dot(axis));
+                    if (score < bestScore) {
+                        bestScore = score;
+                        best = int(t);
+                    }
+                }
+                c++;
+            }
+
+            if (best < 0) {
+                // 이웃이 없으면 원래 순서에서 다음 삼각형 (작은 조각들)
+                while (seedCursor < numTriangles && used[seedCursor]) {
+                    seedCursor++;
+                }
+                if (seedCursor == numTriangles ||
+                    numVertices + countNewVertices(uint32_t(seedCursor),
+                                                   stamp) >
+                        options.maxVertices) {
+                    break;
+                }
+                best = int(seedCursor);
+            }
+
+            next = uint32_t(best);
+        }
+
+        // Meshlet 안에서는 원래 순서를 유지해서 버텍스 캐시 효율 보존
+        sort(meshletTriangles.begin(), meshletTriangles.end());
+
+        Meshlet meshlet;
+        meshlet.startIndex = uint32_t(newIndices.size());
+        meshlet.indexCount = uint32_t(meshletTriangles.size() * 3);
+        for (const auto t : meshletTriangles) {
+            newIndices.insert(newIndices.end(), indices.begin() + t * 3,
+                              indices.begin() + t * 3 + 3);
+        }
+        meshlets.push_back(meshlet);
+        totalVertices += numVertices;
+    }
+
+    indices = std::move(newIndices);
+
+    for (auto &meshlet : meshlets) {
+        ComputeBounds(vertices, indices, meshlet);
+    }
+
+    if (options.printStats) {
+        size_t numCones = 0;
+        for (const auto &meshlet : meshlets) {
+            numCones += meshlet.coneCutoff < 1.0f;
+        }
+        cout << "Meshlets: " << meshlets.size() << " (avg vertices "
+             << float(totalVertices) / meshlets.size() << ", avg triangles "
+             << float(numTriangles) / meshlets.size() << ", cones "
+             << numCones << ")" << endl;
+    }
+}
+
+size_t MeshletBuilder::Cull(const vector<Meshlet> &meshlets,
+                            const Matrix &worldRow, const Matrix &worldITRow,
+                            const Vector3 &eyeWorld, const Matrix &viewProjRow,
+                            vector<IndexRange> &ranges) {
+
+    ranges.clear();
+
+    Vector4 planes[6];
+    Camera::ExtractFrustumPlanes(viewProjRow, planes);
+
+    const float scale = max(
+        {Vector3(worldRow._11, worldRow._12, worldRow._13).Length(),
+         Vector3(worldRow._21, worldRow._22, worldRow._23).Length(),
+         Vector3(worldRow._31, worldRow._32, worldRow._33).Length()});
+
+    size_t numVisible = 0;
+    for (const auto &meshlet : meshlets) {
+        const Vector3 center = Vector3::Transform(meshlet.center, worldRow);
+        const float radius = meshlet.radius * scale;
+
+        bool visible = true;
+        for (const auto &p : planes) {
+            if (p.x * center.x + p.y * center.y + p.z * center.z + p.w <
+                -radius) {
+                visible = false;
+                break;
+            }
+        }
+
+        // 카메라에서 본 방향이 콘 안의 모든 노멀과 같은 쪽이면 뒷면
+        if (visible && meshlet.coneCutoff < 1.0f) {
+            Vector3 axis =
+                Vector3::TransformNormal(meshlet.coneAxis, worldITRow);
+            axis.Normalize();
+            const Vector3 toCenter = center - eyeWorld;
+            if (toCenter.Dot(axis) >=
+                meshlet.coneCutoff * toCenter.Length() + radius) {
+                visible = false;
+            }
+        }
+
+        if (!visible) {
+            continue;
+        }
+
+        numVisible++;
+
+        // 이어지는 범위는 합쳐서 DrawIndexed() 호출 횟수를 줄임
+        if (!ranges.empty() && ranges.back().startIndex +
+                                       ranges.back().indexCount ==
+                                   meshlet.startIndex) {
+            ranges.back().indexCount += meshlet.indexCount;
+        } else {
+            ranges.push_back({meshlet.startIndex, meshlet.indexCount});
+        }
+    }
+
+    return numVisible;
+}
+
+} // namespace Moon
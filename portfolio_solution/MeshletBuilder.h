@@ -0,0 +1,58 @@
+#pragma once
+
+#include "MeshData.h"
+
+namespace Moon {
+
+// 메쉬를 작은 클러스터(Meshlet)로 나눈 후 클러스터 단위로 컬링
+// 메쉬 셰이더 없이 DrawIndexed()로 그릴 수 있도록 각 Meshlet은
+// 인덱스 버퍼 안에서 연속된 범위를 사용
+// 참고: meshoptimizer (buildMeshlets, computeMeshletBounds)
+// https://github.com/zeux/meshoptimizer/blob/master/src/clusterizer.cpp
+// 참고: Arseny Kapoulkine "Mesh shading for Vulkan"
+// https://zeux.io/2023/01/16/meshlet-size-tradeoffs/
+
+struct MeshletOptions {
+    size_t maxVertices = 64;
+    size_t maxTriangles = 124;
+    float coneWeight = 0.5f; // 노멀이 비슷한 삼각형을 모으는 정도
+    bool printStats = false;
+};
+
+struct Meshlet {
+    uint32_t startIndex = 0; // 인덱스 버퍼 안의 위치
+    uint32_t indexCount = 0;
+
+    // 모델 좌표계
+    DirectX::SimpleMath::Vector3 center;
+    float radius = 0.0f;
+
+    // 뒷면 컬링용 노멀 콘 (coneCutoff = sin(퍼진 각도), 1이면 컬링 안함)
+    DirectX::SimpleMath::Vector3 coneAxis;
+    float coneCutoff = 1.0f;
+};
+
+struct IndexRange {
+    uint32_t startIndex = 0;
+    uint32_t indexCount = 0;
+};
+
+class MeshletBuilder {
+  public:
+    // indices를 Meshlet 순서로 다시 정렬하고 Meshlet 목록을 만듦
+    static void Build(const std::vector<Vertex> &vertices,
+                      std::vector<uint32_t> &indices,
+                      std::vector<Meshlet> &meshlets,
+                      const MeshletOptions &options = MeshletOptions());
+
+    // 절두체 밖이거나 모두 뒷면인 Meshlet을 제외하고
+    // 남은 Meshlet들의 인덱스 범위를 붙여서 반환 (남은 Meshlet 개수 반환)
+    static size_t Cull(const std::vector<Meshlet> &meshlets,
+                       const DirectX::SimpleMath::Matrix &worldRow,
+                       const DirectX::SimpleMath::Matrix &worldITRow,
+                       const DirectX::SimpleMath::Vector3 &eyeWorld,
+                       const DirectX::SimpleMath::Matrix &viewProjRow,
+                       std::vector<IndexRange> &ranges);
+};
+
+} // namespace Moon
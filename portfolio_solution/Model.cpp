@@ -1,6 +1,15 @@
 
 #include "Model.h"
 #include "GeometryGenerator.h"
+#include "GeometryRegistry.h"
+#include "GraphicsCommon.h"
+#include "MeshletBuilder.h"
+#include "TextureCache.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
 
 namespace Moon {
 
@@ -14,6 +23,11 @@ Model::Model(ComPtr<ID3D11Device> &device, ComPtr<ID3D11DeviceContext> &context,
     this->Initialize(device, context, meshes);
 }
 
+Model::Model(ComPtr<ID3D11Device> &device,
+             const shared_ptr<const MeshGeometry> &geometry) {
+    this->Initialize(device, geometry);
+}
+
 void Model::Initialize(ComPtr<ID3D11Device> &device,
                        ComPtr<ID3D11DeviceContext> &context,
                        const std::string &basePath,
@@ -35,48 +49,88 @@ void Model::Initialize(ComPtr<ID3D11Device> &device,
     D3D11Utils::CreateConstBuffer(device, m_materialConstsCPU,
                                   m_materialConstsGPU);
 
+    // 메쉬별 바운딩 볼륨을 합쳐서 모델 전체 (모델 좌표계)
+    // 파일에서 읽은 메쉬는 임포트할 때 구해 두었으므로 다시 계산하지 않음
+    m_bounds = MeshBounds();
+    for (const auto &meshData : meshes) {
+        m_bounds = BoundsBuilder::Merge(
+            m_bounds, meshData.bounds.isValid
+                          ? meshData.bounds
+                          : BoundsBuilder::Compute(meshData.vertices, false));
+    }
+    UpdateWorldRow(m_worldRow);
+
+    if (m_buildTriangleBVH) {
+        auto triangleBVH = std::make_shared<TriangleBVH>();
+        triangleBVH->Build(meshes);
+        m_triangleBVH = triangleBVH;
+    }
+    if (m_buildOccluder) {
+        m_occluder = OcclusionCuller::MakeOccluder(meshes);
+    }
+
+    // PackedVertex의 위치는 모델 전체의 AABB 기준 (MeshConstants 하나를 공유)
+    PackingBounds packingBounds;
+    if (m_bounds.isValid) {
+        const Vector3 extents = m_bounds.aabb.Extents;
+        packingBounds.positionMin = Vector3(m_bounds.aabb.Center) - extents;
+        packingBounds.positionExtent = extents * 2.0f;
+    }
+    if (m_usePackedVertices) {
+        m_meshConstsCPU.positionMin = packingBounds.positionMin;
+        m_meshConstsCPU.positionExtent = packingBounds.positionExtent;
+    }
+
+    std::vector<TextureRequest> requests;
+
     for (const auto &meshData : meshes) {
         auto newMesh = std::make_shared<Mesh>();
-        D3D11Utils::CreateVertexBuffer(device, meshData.vertices,
-                                       newMesh->vertexBuffer);
-        newMesh->indexCount = UINT(meshData.indices.size());
-        newMesh->vertexCount = UINT(meshData.vertices.size());
-        newMesh->stride = UINT(sizeof(Vertex));
-        D3D11Utils::CreateIndexBuffer(device, meshData.indices,
-                                      newMesh->indexBuffer);
+        AttachGeometry(*newMesh,
+                       GeometryRegistry::Upload(
+                           device, meshData,
+                           m_usePackedVertices ? &packingBounds : nullptr,
+                           m_printPackingStats));
+
+        // 텍스춰는 요청만 모아두고 아래에서 한꺼번에 처리
+        auto addRequest = [&](const std::string &filename, bool isSRGB,
+                              ComPtr<ID3D11Texture2D> Mesh::*texture,
+                              ComPtr<ID3D11ShaderResourceView> Mesh::*srv) {
+            TextureRequest request;
+            request.mesh = newMesh;
+            request.filename = filename;
+            request.isSRGB = isSRGB;
+            request.texture = texture;
+            request.srv = srv;
+            requests.push_back(std::move(request));
+        };
 
         if (!meshData.albedoTextureFilename.empty()) {
-            D3D11Utils::CreateTexture(
-                device, context, meshData.albedoTextureFilename, true,
-                newMesh->albedoTexture, newMesh->albedoSRV);
+            addRequest(meshData.albedoTextureFilename, true,
+                       &Mesh::albedoTexture, &Mesh::albedoSRV);
             m_materialConstsCPU.useAlbedoMap = true;
         }
 
         if (!meshData.emissiveTextureFilename.empty()) {
-            D3D11Utils::CreateTexture(
-                device, context, meshData.emissiveTextureFilename, true,
-                newMesh->emissiveTexture, newMesh->emissiveSRV);
+            addRequest(meshData.emissiveTextureFilename, true,
+                       &Mesh::emissiveTexture, &Mesh::emissiveSRV);
             m_materialConstsCPU.useEmissiveMap = true;
         }
 
         if (!meshData.normalTextureFilename.empty()) {
-            D3D11Utils::CreateTexture(
-                device, context, meshData.normalTextureFilename, false,
-                newMesh->normalTexture, newMesh->normalSRV);
+            addRequest(meshData.normalTextureFilename, false,
+                       &Mesh::normalTexture, &Mesh::normalSRV);
             m_materialConstsCPU.useNormalMap = true;
         }
 
         if (!meshData.heightTextureFilename.empty()) {
-            D3D11Utils::CreateTexture(
-                device, context, meshData.heightTextureFilename, false,
-                newMesh->heightTexture, newMesh->heightSRV);
+            addRequest(meshData.heightTextureFilename, false,
+                       &Mesh::heightTexture, &Mesh::heightSRV);
             m_meshConstsCPU.useHeightMap = true;
         }
 
         if (!meshData.aoTextureFilename.empty()) {
-            D3D11Utils::CreateTexture(device, context,
-                                      meshData.aoTextureFilename, false,
-                                      newMesh->aoTexture, newMesh->aoSRV);
+            addRequest(meshData.aoTextureFilename, false, &Mesh::aoTexture,
+                       &Mesh::aoSRV);
             m_materialConstsCPU.useAOMap = true;
         }
 
@@ -84,11 +138,12 @@ void Model::Initialize(ComPtr<ID3D11Device> &device,
         // Green : Roughness, Blue : Metallic(Metalness)
         if (!meshData.metallicTextureFilename.empty() ||
             !meshData.roughnessTextureFilename.empty()) {
-            D3D11Utils::CreateMetallicRoughnessTexture(
-                device, context, meshData.metallicTextureFilename,
-                meshData.roughnessTextureFilename,
-                newMesh->metallicRoughnessTexture,
-                newMesh->metallicRoughnessSRV);
+            addRequest(meshData.metallicTextureFilename, false,
+                       &Mesh::metallicRoughnessTexture,
+                       &Mesh::metallicRoughnessSRV);
+            requests.back().roughnessFilename =
+                meshData.roughnessTextureFilename;
+            requests.back().isMetallicRoughness = true;
         }
 
         if (!meshData.metallicTextureFilename.empty()) {
@@ -104,6 +159,193 @@ void Model::Initialize(ComPtr<ID3D11Device> &device,
 
         this->m_meshes.push_back(newMesh);
     }
+
+    TextureCache &cache = TextureCache::Get();
+
+    // 1. 경로로 캐시에서 찾기 (같은 Model 안에서 겹치는 요청도 여기서 거름)
+    std::unordered_map<std::string, size_t> firstByKey;
+    std::vector<size_t> pending;
+    for (size_t i = 0; i < requests.size(); i++) {
+        auto &r = requests[i];
+        r.key = TextureCache::MakeKey(r.filename, r.roughnessFilename,
+                                      r.isSRGB);
+        r.cached = cache.FindByKey(r.key);
+        if (r.cached) {
+            continue;
+        }
+
+        auto it = firstByKey.find(r.key);
+        if (it != firstByKey.end()) {
+            r.sourceIndex = int(it->second);
+        } else {
+            firstByKey[r.key] = i;
+            pending.push_back(i);
+        }
+    }
+
+    // 2. 경로가 다른 같은 파일을 찾기 위해 내용의 해시 계산
+    //    파일은 한 번만 매핑해서 디코딩할 때도 그대로 사용
+    ThreadPool::Get().ParallelFor(pending.size(), [&](size_t k) {
+        auto &r = requests[pending[k]];
+        const std::string *filenames[2] = {&r.filename, &r.roughnessFilename};
+        for (int f = 0; f < 2; f++) {
+            if (!filenames[f]->empty()) {
+                r.files[f] = std::make_unique<MappedFile>();
+                r.files[f]->Open(*filenames[f]);
+            }
+        }
+        r.contentHash = TextureCache::HashContents(
+            r.files[0].get(), r.files[1].get(), r.isSRGB);
+    });
+
+    std::unordered_map<uint64_t, size_t> firstByContent;
+    std::vector<size_t> toDecode;
+    for (const auto i : pending) {
+        auto &r = requests[i];
+        r.cached = cache.FindByContent(r.contentHash);
+        if (r.cached) {
+            cache.AddKey(r.key, r.cached);
+            r.files[0].reset();
+            r.files[1].reset();
+            continue;
+        }
+
+        if (r.contentHash != 0) {
+            auto it = firstByContent.find(r.contentHash);
+            if (it != firstByContent.end()) {
+                r.sourceIndex = int(it->second);
+                r.files[0].reset();
+                r.files[1].reset();
+                continue;
+            }
+            firstByContent[r.contentHash] = i;
+        }
+
+        toDecode.push_back(i);
+    }
+
+    // 3. 디코딩은 작업 스레드들에서 동시에
+    ThreadPool::Get().ParallelFor(toDecode.size(), [&](size_t k) {
+        auto &r = requests[toDecode[k]];
+        if (r.isMetallicRoughness) {
+            D3D11Utils::DecodeMetallicRoughnessTexture(
+                r.filename, r.roughnessFilename, r.image, r.files[0].get(),
+                r.files[1].get());
+        } else {
+            D3D11Utils::DecodeTexture(r.filename, r.isSRGB, r.image,
+                                      r.files[0].get());
+        }
+        r.files[0].reset(); // 매핑 해제
+        r.files[1].reset();
+    });
+
+    // 4. 업로드는 디바이스 컨텍스트를 사용하므로 메인 스레드에서 차례대로
+    for (const auto i : toDecode) {
+        auto &r = requests[i];
+
+        auto startTime = std::chrono::steady_clock::now();
+
+        auto newTexture = std::make_shared<CachedTexture>();
+        D3D11Utils::UploadTexture(device, context, r.image,
+                                  newTexture->texture, newTexture->srv);
+
+        const double uploadMs =
+            std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - startTime)
+                .count();
+
+        if (m_printTextureStats) {
+            std::cout << r.filename << " " << r.image.width << " "
+                      << r.image.height << " decode " << r.image.decodeMs
+                      << "ms, convert " << r.image.convertMs << "ms, upload "
+                      << uploadMs << "ms" << std::endl;
+        }
+
+        if (newTexture->srv) {
+            // 밉맵까지 포함하면 약 4/3배
+            const size_t pixelSize =
+                r.image.pixelFormat == DXGI_FORMAT_R16G16B16A16_FLOAT ? 8 : 4;
+            newTexture->bytes = size_t(r.image.width) * r.image.height *
+                                pixelSize * 4 / 3;
+
+            r.cached = newTexture;
+            cache.Insert(r.key, r.contentHash, newTexture);
+        }
+
+        r.image.image = std::vector<uint8_t>(); // 메모리 바로 해제
+    }
+
+    // 5. Mesh에 연결 (sourceIndex는 항상 앞쪽 요청을 가리킴)
+    for (auto &r : requests) {
+        if (r.sourceIndex >= 0) {
+            r.cached = requests[r.sourceIndex].cached;
+            if (r.cached) {
+                cache.RecordHit(r.cached);
+                cache.AddKey(r.key, r.cached);
+            }
+        }
+
+        if (r.cached) {
+            (*r.mesh).*r.texture = r.cached->texture;
+            (*r.mesh).*r.srv = r.cached->srv;
+            r.mesh->textures.push_back(r.cached);
+        }
+    }
+
+    if (m_printTextureStats && !requests.empty()) {
+        const auto stats = cache.GetStats();
+        std::cout << "TextureCache hits " << stats.hits << ", misses "
+                  << stats.misses << ", saved "
+                  << stats.bytesSaved / (1024 * 1024) << "MB" << std::endl;
+    }
+}
+
+void Model::Initialize(ComPtr<ID3D11Device> &device,
+                       const shared_ptr<const MeshGeometry> &geometry) {
+
+    D3D11Utils::CreateConstBuffer(device, m_meshConstsCPU, m_meshConstsGPU);
+    D3D11Utils::CreateConstBuffer(device, m_materialConstsCPU,
+                                  m_materialConstsGPU);
+
+    m_bounds = geometry->bounds;
+    UpdateWorldRow(m_worldRow);
+
+    m_usePackedVertices = geometry->isPacked;
+    if (m_usePackedVertices) {
+        m_meshConstsCPU.positionMin = geometry->packingBounds.positionMin;
+        m_meshConstsCPU.positionExtent = geometry->packingBounds.positionExtent;
+    }
+
+    auto newMesh = std::make_shared<Mesh>();
+    AttachGeometry(*newMesh, geometry);
+    newMesh->vertexConstBuffer = m_meshConstsGPU;
+    newMesh->pixelConstBuffer = m_materialConstsGPU;
+
+    m_meshes.push_back(newMesh);
+}
+
+void Model::AttachGeometry(Mesh &mesh,
+                           const shared_ptr<const MeshGeometry> &geometry) {
+
+    // 버퍼는 참조만 늘리고, 컬링 결과(visibleRanges)는 Mesh마다 따로
+    mesh.geometry = geometry;
+    mesh.vertexBuffer = geometry->vertexBuffer;
+    mesh.indexBuffer = geometry->indexBuffer;
+    mesh.indexCount = geometry->indexCount;
+    mesh.vertexCount = geometry->vertexCount;
+    mesh.stride = geometry->stride;
+    mesh.lods = geometry->lods;
+    mesh.meshlets = geometry->meshlets;
+
+    if (mesh.meshlets) {
+        m_numMeshlets += mesh.meshlets->size();
+    }
+}
+
+void Model::AddMesh(const shared_ptr<Mesh> &mesh) {
+    mesh->vertexConstBuffer = m_meshConstsGPU;
+    mesh->pixelConstBuffer = m_materialConstsGPU;
+    m_meshes.push_back(mesh);
 }
 
 void Model::UpdateConstantBuffers(ComPtr<ID3D11Device> &device,
@@ -117,40 +359,187 @@ void Model::UpdateConstantBuffers(ComPtr<ID3D11Device> &device,
     }
 }
 
-void Model::Render(ComPtr<ID3D11DeviceContext> &context) {
-    if (m_isVisible) {
-        for (const auto &mesh : m_meshes) {
-            context->VSSetConstantBuffers(
-                0, 1, mesh->vertexConstBuffer.GetAddressOf());
-            context->PSSetConstantBuffers(
-                0, 1, mesh->pixelConstBuffer.GetAddressOf());
+bool Model::BindPackedVertexShader(ComPtr<ID3D11DeviceContext> &context,
+                                   ComPtr<ID3D11VertexShader> &prevVS,
+                                   ComPtr<ID3D11InputLayout> &prevIL) {
 
-            context->VSSetShaderResources(0, 1, mesh->heightSRV.GetAddressOf());
+    // 지금 설정된 쉐이더를 같은 쉐이더의 PACKED_VERTEX 버전으로 교체
+    context->VSGetShader(prevVS.GetAddressOf(), nullptr, nullptr);
+    ID3D11VertexShader *packedVS =
+        Graphics::GetPackedVertexShader(prevVS.Get());
+    if (!packedVS) {
+        return false; // PackedVertex를 지원하지 않는 패스
+    }
 
-            // 물체 렌더링할 때 여러가지 텍스춰 사용 (t0 부터시작)
-            vector<ID3D11ShaderResourceView *> resViews = {
-                mesh->albedoSRV.Get(), mesh->normalSRV.Get(), mesh->aoSRV.Get(),
-                mesh->metallicRoughnessSRV.Get(), mesh->emissiveSRV.Get()};
-            context->PSSetShaderResources(0, UINT(resViews.size()),
-                                          resViews.data());
+    context->IAGetInputLayout(prevIL.GetAddressOf());
+    context->VSSetShader(packedVS, 0, 0);
+    context->IASetInputLayout(Graphics::packedIL.Get());
+    return true;
+}
 
-            context->IASetVertexBuffers(0, 1, mesh->vertexBuffer.GetAddressOf(),
-                                        &mesh->stride, &mesh->offset);
+void Model::Render(ComPtr<ID3D11DeviceContext> &context,
+                   bool useMeshletCulling) {
 
-            context->IASetIndexBuffer(mesh->indexBuffer.Get(),
-                                      DXGI_FORMAT_R32_UINT, 0);
-            context->DrawIndexed(mesh->indexCount, 0, 0);
+    ComPtr<ID3D11VertexShader> prevVS;
+    ComPtr<ID3D11InputLayout> prevIL;
+    if (m_isVisible && m_usePackedVertices &&
+        !BindPackedVertexShader(context, prevVS, prevIL)) {
+        return;
+    }
+
+    if (m_isVisible) {
+        // 바로 앞 메쉬와 같은 리소스는 다시 바인딩하지 않음
+        // (메쉬들은 Model의 상수 버퍼를 공유하고 텍스춰도 겹치는 경우가 많음)
+        const Mesh *prev = nullptr;
+        for (const auto &mesh : m_meshes) {
+            if (!prev || prev->vertexConstBuffer != mesh->vertexConstBuffer) {
+                context->VSSetConstantBuffers(
+                    0, 1, mesh->vertexConstBuffer.GetAddressOf());
+            }
+            if (!prev || prev->pixelConstBuffer != mesh->pixelConstBuffer) {
+                context->PSSetConstantBuffers(
+                    0, 1, mesh->pixelConstBuffer.GetAddressOf());
+            }
+
+            if (!prev || prev->heightSRV != mesh->heightSRV) {
+                context->VSSetShaderResources(0, 1,
+                                              mesh->heightSRV.GetAddressOf());
+            }
+
+            // 물체 렌더링할 때 여러가지 텍스춰 사용 (t0 부터시작)
+            if (!prev || prev->albedoSRV != mesh->albedoSRV ||
+                prev->normalSRV != mesh->normalSRV ||
+                prev->aoSRV != mesh->aoSRV ||
+                prev->metallicRoughnessSRV != mesh->metallicRoughnessSRV ||
+                prev->emissiveSRV != mesh->emissiveSRV) {
+                ID3D11ShaderResourceView *resViews[] = {
+                    mesh->albedoSRV.Get(), mesh->normalSRV.Get(),
+                    mesh->aoSRV.Get(), mesh->metallicRoughnessSRV.Get(),
+                    mesh->emissiveSRV.Get()};
+                context->PSSetShaderResources(0, UINT(std::size(resViews)),
+                                              resViews);
+            }
+
+            if (!prev || prev->vertexBuffer != mesh->vertexBuffer ||
+                prev->stride != mesh->stride || prev->offset != mesh->offset) {
+                context->IASetVertexBuffers(0, 1,
+                                            mesh->vertexBuffer.GetAddressOf(),
+                                            &mesh->stride, &mesh->offset);
+            }
+
+            if (!prev || prev->indexBuffer != mesh->indexBuffer) {
+                context->IASetIndexBuffer(mesh->indexBuffer.Get(),
+                                          DXGI_FORMAT_R32_UINT, 0);
+            }
+            prev = mesh.get();
+
+            if (useMeshletCulling && m_meshletsCulled && mesh->meshlets &&
+                !mesh->meshlets->empty()) {
+                for (const auto &range : mesh->visibleRanges) {
+                    context->DrawIndexed(range.indexCount, range.startIndex,
+                                         0);
+                }
+                continue;
+            }
+
+            const std::vector<MeshLod> &lods = *mesh->lods;
+            const MeshLod &lod =
+                lods[std::min(size_t(m_lodLevel), lods.size() - 1)];
+            context->DrawIndexed(lod.indexCount, lod.startIndex, 0);
         }
     }
+
+    if (prevVS) {
+        context->VSSetShader(prevVS.Get(), 0, 0);
+        context->IASetInputLayout(prevIL.Get());
+    }
 }
 
 void Model::RenderNormals(ComPtr<ID3D11DeviceContext> &context) {
+
+    ComPtr<ID3D11VertexShader> prevVS;
+    ComPtr<ID3D11InputLayout> prevIL;
+    if (m_usePackedVertices) {
+        if (!BindPackedVertexShader(context, prevVS, prevIL)) {
+            return;
+        }
+        context->VSSetConstantBuffers(0, 1, m_meshConstsGPU.GetAddressOf());
+    }
+
     for (const auto &mesh : m_meshes) {
         context->GSSetConstantBuffers(0, 1, m_meshConstsGPU.GetAddressOf());
         context->IASetVertexBuffers(0, 1, mesh->vertexBuffer.GetAddressOf(),
                                     &mesh->stride, &mesh->offset);
         context->Draw(mesh->vertexCount, 0);
     }
+
+    if (prevVS) {
+        context->VSSetShader(prevVS.Get(), 0, 0);
+        context->IASetInputLayout(prevIL.Get());
+    }
+}
+
+void Model::UpdateLod(const Vector3 &eyeWorld, const Matrix &projRow) {
+
+    // 월드 공간의 바운딩 스피어 (UpdateWorldRow()에서 변환해 둠)
+    const Vector3 center = m_worldBounds.sphere.Center;
+    const float radius = m_worldBounds.sphere.Radius;
+
+    // 화면 높이 대비 투영된 지름 (projRow._22 = 1 / tan(fovY / 2))
+    const float distance = (center - eyeWorld).Length();
+    if (distance <= radius) {
+        m_lodLevel = 0; // 카메라가 안에 있음
+        return;
+    }
+    const float screenSize = radius * projRow._22 / distance;
+
+    // 화면 크기가 절반이 될 때마다 다음 LOD
+    int level = 0;
+    float threshold = m_lodScreenSize;
+    while (screenSize < threshold && level < 7) {
+        threshold *= 0.5f;
+        level++;
+    }
+    m_lodLevel = level;
+}
+
+void Model::CullMeshlets(const Vector3 &eyeWorld, const Matrix &viewProjRow) {
+
+    // 간략화된 LOD는 Meshlet이 없으므로 통째로 그림
+    m_meshletsCulled = m_useMeshletCulling && m_lodLevel == 0;
+    m_numVisibleMeshlets = 0;
+    if (!m_meshletsCulled) {
+        return;
+    }
+
+    for (const auto &mesh : m_meshes) {
+        if (!mesh->meshlets) {
+            continue;
+        }
+        m_numVisibleMeshlets += MeshletBuilder::Cull(
+            *mesh->meshlets, m_worldRow, m_worldITRow, eyeWorld, viewProjRow,
+            mesh->visibleRanges);
+    }
+}
+
+bool Model::RayCast(const DirectX::SimpleMath::Ray &rayWorld,
+                    TriangleHit &hit) const {
+
+    if (!m_triangleBVH) {
+        return false;
+    }
+
+    // 광선을 모델 좌표계로 옮겨도 매개변수 t는 그대로
+    const Matrix worldInvRow = m_worldRow.Invert();
+    const Vector3 origin = Vector3::Transform(rayWorld.position, worldInvRow);
+    const Vector3 dir =
+        Vector3::TransformNormal(rayWorld.direction, worldInvRow);
+    if (!m_triangleBVH->RayCast(origin, dir, hit)) {
+        return false;
+    }
+
+    hit.point = rayWorld.position + rayWorld.direction * hit.distance;
+    return true;
 }
 
 void Model::UpdateWorldRow(const Matrix &worldRow) {
@@ -161,6 +550,9 @@ void Model::UpdateWorldRow(const Matrix &worldRow) {
 
     m_meshConstsCPU.world = worldRow.Transpose();
     m_meshConstsCPU.worldIT = m_worldITRow.Transpose();
+
+    m_worldBounds = BoundsBuilder::Transform(m_bounds, worldRow);
+    m_worldBoundsVersion++;
 }
 
 } // namespace hlab
\ No newline at end of file
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <DirectXCollision.h>
+
 #include "ConstantBuffers.h"
 #include "D3D11Utils.h"
+#include "GeometryRegistry.h"
 #include "Mesh.h"
 #include "MeshData.h"
+#include "OcclusionCuller.h"
+#include "TriangleBVH.h"
 
 // 참고: DirectX-Graphics-Sampels
 // https://github.com/microsoft/DirectX-Graphics-Samples/blob/master/MiniEngine/Model/Model.h
@@ -17,6 +22,8 @@ class Model {
           const std::string &basePath, const std::string &filename);
     Model(ComPtr<ID3D11Device> &device, ComPtr<ID3D11DeviceContext> &context,
           const std::vector<MeshData> &meshes);
+    Model(ComPtr<ID3D11Device> &device,
+          const shared_ptr<const MeshGeometry> &geometry);
 
     void Initialize(ComPtr<ID3D11Device> &device,
                     ComPtr<ID3D11DeviceContext> &context,
@@ -26,15 +33,36 @@ class Model {
                     ComPtr<ID3D11DeviceContext> &context,
                     const std::vector<MeshData> &meshes);
 
+    // GeometryRegistry의 지오메트리를 공유 (상수 버퍼와 재질은 Model마다)
+    // 이미 올라간 버퍼를 쓰므로 디바이스 컨텍스트는 필요 없음
+    void Initialize(ComPtr<ID3D11Device> &device,
+                    const shared_ptr<const MeshGeometry> &geometry);
+
+    // 직접 만든 Mesh에 이 Model의 상수 버퍼를 연결해서 추가 (예: Terrain)
+    void AddMesh(const shared_ptr<Mesh> &mesh);
+
     void UpdateConstantBuffers(ComPtr<ID3D11Device> &device,
                                ComPtr<ID3D11DeviceContext> &context);
 
-    void Render(ComPtr<ID3D11DeviceContext> &context);
+    // useMeshletCulling: CullMeshlets()와 다른 시점(예: 거울)에서는 false
+    void Render(ComPtr<ID3D11DeviceContext> &context,
+                bool useMeshletCulling = true);
 
     void RenderNormals(ComPtr<ID3D11DeviceContext> &context);
 
     void UpdateWorldRow(const Matrix &worldRow);
 
+    // 월드 공간 광선과 가장 가까운 삼각형 (m_triangleBVH가 없으면 false)
+    // hit.point와 hit.distance는 월드 공간 (ray.direction이 정규화일 때)
+    bool RayCast(const DirectX::SimpleMath::Ray &rayWorld,
+                 TriangleHit &hit) const;
+
+    // 화면에 투영된 크기로 LOD 선택
+    void UpdateLod(const Vector3 &eyeWorld, const Matrix &projRow);
+
+    // 보이는 Meshlet들만 그리도록 인덱스 범위 갱신 (LOD0일 때만)
+    void CullMeshlets(const Vector3 &eyeWorld, const Matrix &viewProjRow);
+
   public:
     Matrix m_worldRow = Matrix();   // Model(Object) To World 행렬
     Matrix m_worldITRow = Matrix(); // InverseTranspose
@@ -45,9 +73,63 @@ class Model {
     bool m_drawNormals = false;
     bool m_isVisible = true;
 
+    MeshBounds m_bounds;      // 모델 좌표계, 모든 메쉬를 포함
+    MeshBounds m_worldBounds; // UpdateWorldRow()에서 m_bounds를 변환
+    uint32_t m_worldBoundsVersion = 0; // m_worldBounds가 바뀔 때마다 증가
+    int m_lodLevel = 0;
+    float m_lodScreenSize = 0.5f; // 화면 높이 대비 크기가 이보다 작으면 LOD1
+
+    // Initialize() 전에 설정, 버텍스를 PackedVertex(20바이트)로 저장
+    bool m_usePackedVertices = false;
+    bool m_printPackingStats = false; // PackedVertex 크기와 최대 오차 출력
+
+    // Initialize() 전에 설정, 텍스춰마다 디코딩/변환/업로드 시간과
+    // TextureCache 적중 통계 출력
+    bool m_printTextureStats = false;
+
+    // Initialize() 전에 설정, MeshData로 피킹용 삼각형 BVH를 만듦 (모델 좌표계)
+    bool m_buildTriangleBVH = false;
+    shared_ptr<const TriangleBVH> m_triangleBVH;
+
+    // Initialize() 전에 설정, LOD0 삼각형을 CPU 오클루전 컬링에 사용
+    bool m_buildOccluder = false;
+    shared_ptr<const OccluderMesh> m_occluder;
+
+    bool m_useMeshletCulling = true;
+    bool m_meshletsCulled = false; // visibleRanges가 유효한지
+    size_t m_numMeshlets = 0;
+    size_t m_numVisibleMeshlets = 0;
+
     std::vector<shared_ptr<Mesh>> m_meshes;
 
   private:
+    void AttachGeometry(Mesh &mesh,
+                        const shared_ptr<const MeshGeometry> &geometry);
+
+    // 실패하면 (PACKED_VERTEX 버전이 없는 쉐이더) 그리지 않음
+    bool BindPackedVertexShader(ComPtr<ID3D11DeviceContext> &context,
+                                ComPtr<ID3D11VertexShader> &prevVS,
+                                ComPtr<ID3D11InputLayout> &prevIL);
+
+    // Initialize()에서 텍스춰를 한꺼번에 읽기 위한 요청
+    struct TextureRequest {
+        shared_ptr<Mesh> mesh;
+        std::string filename;
+        std::string roughnessFilename; // isMetallicRoughness일 때만 사용
+        bool isSRGB = false;
+        ComPtr<ID3D11Texture2D> Mesh::*texture = nullptr;
+        ComPtr<ID3D11ShaderResourceView> Mesh::*srv = nullptr;
+        bool isMetallicRoughness = false;
+        TextureImage image;
+
+        std::string key;          // TextureCache 키
+        uint64_t contentHash = 0; // 파일 내용의 해시
+        // filename, roughnessFilename을 매핑한 것 (해시와 디코딩에 같이 사용)
+        std::unique_ptr<MappedFile> files[2];
+        int sourceIndex = -1;     // 같은 텍스춰를 읽는 앞쪽 요청
+        shared_ptr<CachedTexture> cached;
+    };
+
     ComPtr<ID3D11Buffer> m_meshConstsGPU;
     ComPtr<ID3D11Buffer> m_materialConstsGPU;
 };
@@ -1,56 +1,36 @@
 #include "ModelLoader.h"
 
-#include <DirectXMesh.h>
 #include <filesystem>
 #include <vector>
 
+#include "GLTFLoader.h"
+#include "MeshOptimizer.h"
+#include "NormalGenerator.h"
+#include "TangentGenerator.h"
+#include "ThreadPool.h"
+#include "VertexWelder.h"
+
 namespace Moon {
 
 using namespace std;
 using namespace DirectX::SimpleMath;
 
-void UpdateNormals(vector<MeshData> &meshes) {
-
-    // 노멀 벡터가 없는 경우를 대비하여 다시 계산
-    // 한 위치에는 한 버텍스만 있어야 연결 관계를 찾을 수 있음
-
-    // DirectXMesh의 ComputeNormals()과 비슷합니다.
-    // https://github.com/microsoft/DirectXMesh/wiki/ComputeNormals
-
-    for (auto &m : meshes) {
-
-        vector<Vector3> normalsTemp(m.vertices.size(), Vector3(0.0f));
-        vector<float> weightsTemp(m.vertices.size(), 0.0f);
-
-        for (int i = 0; i < m.indices.size(); i += 3) {
-
-            int idx0 = m.indices[i];
-            int idx1 = m.indices[i + 1];
-            int idx2 = m.indices[i + 2];
-
-            auto v0 = m.vertices[idx0];
-            auto v1 = m.vertices[idx1];
-            auto v2 = m.vertices[idx2];
+// Assimp가 연 파일들을 기록 (.gltf의 .bin, .obj의 .mtl 등)
+class RecordingIOSystem : public Assimp::DefaultIOSystem {
+  public:
+    explicit RecordingIOSystem(vector<string> &files) : m_files(files) {}
 
-            auto faceNormal =
-                (v1.position - v0.position).Cross(v2.position - v0.position);
-
-            normalsTemp[idx0] += faceNormal;
-            normalsTemp[idx1] += faceNormal;
-            normalsTemp[idx2] += faceNormal;
-            weightsTemp[idx0] += 1.0f;
-            weightsTemp[idx1] += 1.0f;
-            weightsTemp[idx2] += 1.0f;
-        }
-
-        for (int i = 0; i < m.vertices.size(); i++) {
-            if (weightsTemp[i] > 0.0f) {
-                m.vertices[i].normalModel = normalsTemp[i] / weightsTemp[i];
-                m.vertices[i].normalModel.Normalize();
-            }
+    Assimp::IOStream *Open(const char *file, const char *mode) override {
+        Assimp::IOStream *stream = DefaultIOSystem::Open(file, mode);
+        if (stream) {
+            m_files.push_back(file);
         }
+        return stream;
     }
-}
+
+  private:
+    vector<string> &m_files;
+};
 
 string GetExtension(const string filename) {
     string ext(filesystem::path(filename).extension().string());
@@ -60,14 +40,36 @@ string GetExtension(const string filename) {
 
 void ModelLoader::Load(std::string basePath, std::string filename, bool revertNormals) {
 
-    if (GetExtension(filename) == ".gltf") {
+    const string ext = GetExtension(filename);
+    if (ext == ".gltf" || ext == ".glb") {
         m_isGLTF = true;
         m_revertNormals = revertNormals;
     }
 
     this->basePath = basePath;
+    this->sourceFiles = {basePath + filename};
+
+    // glTF는 Assimp를 거치지 않고 직접 읽음 (결과는 아래 Assimp 경로와 동일)
+    // 지원하지 않는 파일이면 Assimp로 다시 읽음
+    if (m_isGLTF && m_useNativeGLTF) {
+        if (GLTFLoader::Load(this->basePath, filename, m_revertNormals,
+                             this->meshes, &this->sourceFiles)) {
+            if (m_weldVertices) {
+                VertexWelder::Weld(this->meshes, m_weldOptions);
+            }
+            UpdateNormals();
+            if (m_optimizeMeshes) {
+                MeshOptimizer::Optimize(this->meshes, m_optimizeOptions);
+            }
+            UpdateTangents();
+            return;
+        }
+        this->meshes.clear();
+    }
 
     Assimp::Importer importer;
+    // importer가 소멸할 때 함께 해제
+    importer.SetIOHandler(new RecordingIOSystem(this->sourceFiles));
 
     const aiScene *pScene = importer.ReadFile(
         this->basePath + filename,
@@ -76,49 +78,96 @@ void ModelLoader::Load(std::string basePath, std::string filename, bool revertNo
     if (!pScene) {
         std::cout << "Failed to read file: " << this->basePath + filename
                   << std::endl;
+    } else if (m_parallel) {
+        // 노드 트리를 (메쉬, 누적 변환) 목록으로 펼친 다음 병렬 처리
+        // 목록이 ProcessNode()의 방문 순서와 같으므로 meshes의 순서도 동일
+        vector<MeshWorkItem> items;
+        CollectMeshes(pScene->mRootNode, pScene, Matrix(), items);
+
+        this->meshes.resize(items.size());
+        ThreadPool::Get().ParallelFor(items.size(), [&](size_t i) {
+            this->meshes[i] = ProcessMesh(items[i].mesh, pScene);
+            for (auto &v : this->meshes[i].vertices) {
+                v.position = Vector3::Transform(v.position, items[i].transform);
+            }
+        });
     } else {
         Matrix tr; // Initial transformation
         ProcessNode(pScene->mRootNode, pScene, tr);
     }
 
-    // UpdateNormals(this->meshes); // Vertex Normal을 직접 계산 (참고용)
+    // Assimp에 aiProcess_JoinIdenticalVertices를 사용하지 않으므로 직접 합침
+    if (m_weldVertices) {
+        VertexWelder::Weld(this->meshes, m_weldOptions);
+    }
+
+    UpdateNormals();
+
+    // 버텍스 캐시/Overdraw/Vertex fetch 순서 최적화
+    if (m_optimizeMeshes) {
+        MeshOptimizer::Optimize(this->meshes, m_optimizeOptions);
+    }
 
     UpdateTangents();
 }
 
-void ModelLoader::UpdateTangents() {
-
-    using namespace std;
-    using namespace DirectX;
+void ModelLoader::UpdateNormals() {
 
-    // https://github.com/microsoft/DirectXMesh/wiki/ComputeTangentFrame
+    // 노멀이 없는 메쉬만 다시 계산 (용접 후에 해야 이웃을 찾을 수 있음)
+    // glTF는 노멀이 없으면 flat 노멀을 사용하도록 정해져 있음
+    // https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html#meshes-overview
+    NormalOptions options;
+    options.creaseAngle = m_isGLTF ? 0.0f : m_creaseAngle;
+    options.parallel = m_parallel;
 
     for (auto &m : this->meshes) {
-
-        vector<XMFLOAT3> positions(m.vertices.size());
-        vector<XMFLOAT3> normals(m.vertices.size());
-        vector<XMFLOAT2> texcoords(m.vertices.size());
-        vector<XMFLOAT3> tangents(m.vertices.size());
-        vector<XMFLOAT3> bitangents(m.vertices.size());
-
-        for (size_t i = 0; i < m.vertices.size(); i++) {
-            auto &v = m.vertices[i];
-            positions[i] = v.position;
-            normals[i] = v.normalModel;
-            texcoords[i] = v.texcoord;
+        if (m_generateNormals && NormalGenerator::NeedsNormals(m)) {
+            NormalGenerator::Generate(m, options);
         }
+    }
+}
+
+void ModelLoader::UpdateTangents() {
+
+    // 메쉬 안에서도 삼각형 범위별로 나눠서 병렬 처리
+    TangentOptions options;
+    options.parallel = m_parallel;
 
-        ComputeTangentFrame(m.indices.data(), m.indices.size() / 3,
-                            positions.data(), normals.data(), texcoords.data(),
-                            m.vertices.size(), tangents.data(),
-                            bitangents.data());
+    // 메쉬마다 독립적이므로 병렬로 계산
+    auto updateTangents = [&](size_t meshIndex) {
+        TangentGenerator::Generate(this->meshes[meshIndex], options);
+    };
 
-        for (size_t i = 0; i < m.vertices.size(); i++) {
-            m.vertices[i].tangentModel = tangents[i];
+    if (m_parallel) {
+        ThreadPool::Get().ParallelFor(this->meshes.size(), updateTangents);
+    } else {
+        for (size_t i = 0; i < this->meshes.size(); i++) {
+            updateTangents(i);
         }
     }
 }
 
+void ModelLoader::CollectMeshes(aiNode *node, const aiScene *scene, Matrix tr,
+                                vector<MeshWorkItem> &items) {
+
+    // ProcessNode()와 같은 순서로 방문
+    Matrix m;
+    ai_real *temp = &node->mTransformation.a1;
+    float *mTemp = &m._11;
+    for (int t = 0; t < 16; t++) {
+        mTemp[t] = float(temp[t]);
+    }
+    m = m.Transpose() * tr;
+
+    for (UINT i = 0; i < node->mNumMeshes; i++) {
+        items.push_back({scene->mMeshes[node->mMeshes[i]], m});
+    }
+
+    for (UINT i = 0; i < node->mNumChildren; i++) {
+        CollectMeshes(node->mChildren[i], scene, m, items);
+    }
+}
+
 void ModelLoader::ProcessNode(aiNode *node, const aiScene *scene, Matrix tr) {
 
     // std::cout << node->mName.C_Str() << " : " << node->mNumMeshes << " "
@@ -141,7 +190,7 @@ void ModelLoader::ProcessNode(aiNode *node, const aiScene *scene, Matrix tr) {
             v.position = DirectX::SimpleMath::Vector3::Transform(v.position, m);
         }
 
-        meshes.push_back(newMesh);
+        meshes.push_back(std::move(newMesh));
     }
 
     for (UINT i = 0; i < node->mNumChildren; i++) {
@@ -168,51 +217,53 @@ string ModelLoader::ReadFilename(aiMaterial *material, aiTextureType type) {
 
 MeshData ModelLoader::ProcessMesh(aiMesh *mesh, const aiScene *scene) {
 
-    // Data to fill
-    std::vector<Vertex> vertices;
-    std::vector<uint32_t> indices;
+    // 최종 버퍼 크기를 미리 정하고 직접 채움 (중간 복사 X)
+    MeshData newMesh;
+    std::vector<Vertex> &vertices = newMesh.vertices;
+    std::vector<uint32_t> &indices = newMesh.indices;
+
+    vertices.resize(mesh->mNumVertices);
 
     // Walk through each of the mesh's vertices
     for (UINT i = 0; i < mesh->mNumVertices; i++) {
-        Vertex vertex;
+        Vertex &vertex = vertices[i];
 
         vertex.position.x = mesh->mVertices[i].x;
         vertex.position.y = mesh->mVertices[i].y;
         vertex.position.z = mesh->mVertices[i].z;
 
-        vertex.normalModel.x = mesh->mNormals[i].x;
-        if (m_isGLTF) {
-            vertex.normalModel.y = mesh->mNormals[i].z;
-            vertex.normalModel.z = -mesh->mNormals[i].y;
-        } else {
-            vertex.normalModel.y = mesh->mNormals[i].y;
-            vertex.normalModel.z = mesh->mNormals[i].z;
-        }
+        // 노멀이 없으면 0으로 두고 UpdateNormals()에서 계산
+        if (mesh->mNormals) {
+            vertex.normalModel.x = mesh->mNormals[i].x;
+            if (m_isGLTF) {
+                vertex.normalModel.y = mesh->mNormals[i].z;
+                vertex.normalModel.z = -mesh->mNormals[i].y;
+            } else {
+                vertex.normalModel.y = mesh->mNormals[i].y;
+                vertex.normalModel.z = mesh->mNormals[i].z;
+            }
 
-        if (m_revertNormals) {
-            vertex.normalModel *= -1.0f;
-        }
+            if (m_revertNormals) {
+                vertex.normalModel *= -1.0f;
+            }
 
-        vertex.normalModel.Normalize();
+            vertex.normalModel.Normalize();
+        }
 
         if (mesh->mTextureCoords[0]) {
             vertex.texcoord.x = (float)mesh->mTextureCoords[0][i].x;
             vertex.texcoord.y = (float)mesh->mTextureCoords[0][i].y;
         }
-
-        vertices.push_back(vertex);
     }
 
+    // aiProcess_Triangulate 후에는 대부분 삼각형
+    indices.reserve(size_t(mesh->mNumFaces) * 3);
     for (UINT i = 0; i < mesh->mNumFaces; i++) {
-        aiFace face = mesh->mFaces[i];
-        for (UINT j = 0; j < face.mNumIndices; j++)
-            indices.push_back(face.mIndices[j]);
+        const aiFace &face = mesh->mFaces[i]; // 복사하면 인덱스 배열도 할당
+        indices.insert(indices.end(), face.mIndices,
+                       face.mIndices + face.mNumIndices);
     }
 
-    MeshData newMesh;
-    newMesh.vertices = vertices;
-    newMesh.indices = indices;
-
     // http://assimp.sourceforge.net/lib_html/materials.html
     if (mesh->mMaterialIndex >= 0) {
 
@@ -4,6 +4,7 @@
 
 // vcpkg install assimp:x64-windows
 // Preprocessor definitions에 NOMINMAX 추가
+#include <assimp\DefaultIOSystem.h>
 #include <assimp\Importer.hpp>
 #include <assimp\postprocess.h>
 #include <assimp\scene.h>
@@ -12,13 +13,25 @@
 #include <vector>
 
 #include "MeshData.h"
+#include "MeshOptimizer.h"
 #include "Vertex.h"
+#include "VertexWelder.h"
 
 namespace Moon {
 class ModelLoader {
   public:
     void Load(std::string basePath, std::string filename, bool revertNormals);
 
+    // 병렬 처리용 작업 단위 (메쉬와 노드들의 누적 변환)
+    struct MeshWorkItem {
+        aiMesh *mesh;
+        DirectX::SimpleMath::Matrix transform;
+    };
+
+    void CollectMeshes(aiNode *node, const aiScene *scene,
+                       DirectX::SimpleMath::Matrix tr,
+                       std::vector<MeshWorkItem> &items);
+
     void ProcessNode(aiNode *node, const aiScene *scene,
                      DirectX::SimpleMath::Matrix tr);
 
@@ -26,12 +39,23 @@ class ModelLoader {
 
     std::string ReadFilename(aiMaterial *material, aiTextureType type);
 
+    void UpdateNormals();
+
     void UpdateTangents();
 
   public:
     std::string basePath;
     std::vector<MeshData> meshes;
+    std::vector<std::string> sourceFiles; // 읽은 파일들 (MeshCache의 키)
     bool m_isGLTF = false; // gltf or fbx
     bool m_revertNormals = false;
+    bool m_useNativeGLTF = true;   // false면 glTF도 Assimp로 읽음 (비교용)
+    bool m_parallel = true;        // 메쉬 처리와 탄젠트 계산을 병렬로
+    bool m_weldVertices = true;    // 중복 버텍스 합치기 (VertexWelder)
+    bool m_optimizeMeshes = true;  // 인덱스/버텍스 순서 최적화 (MeshOptimizer)
+    WeldOptions m_weldOptions;
+    MeshOptimizeOptions m_optimizeOptions;
+    bool m_generateNormals = true; // 노멀이 없는 메쉬는 NormalGenerator로 계산
+    float m_creaseAngle = 60.0f;   // 이보다 크게 꺾인 모서리는 노멀을 나눔
 };
 } // namespace hlab
\ No newline at end of file
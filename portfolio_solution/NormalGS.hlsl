@@ -7,6 +7,10 @@ cbuffer MeshConstants : register(b0)
     int useHeightMap;
     float heightScale;
     float2 dummy;
+    float3 positionMin;    // PackedVertex의 위치 복원
+    float dummy1;
+    float3 positionExtent;
+    float dummy2;
 };
 
 struct NormalGeometryShaderInput
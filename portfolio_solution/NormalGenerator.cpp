@@ -0,0 +1,331 @@
+#include "NormalGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+
+#include "ThreadPool.h"
+#include "Vec3x4.h"
+
+namespace Moon {
+
+using namespace std;
+using namespace DirectX;
+using DirectX::SimpleMath::Vector3;
+
+namespace {
+
+const size_t TRIANGLES_PER_TASK = 65536; // 4의 배수
+const size_t ITEMS_PER_TASK = 65536;
+
+// 위치가 같은 버텍스들에 같은 번호를 붙임 (open addressing 해시)
+uint32_t GroupByPosition(const vector<Vertex> &vertices,
+                         vector<uint32_t> &positionIds) {
+
+    size_t tableSize = 1;
+    while (tableSize < vertices.size() * 2) {
+        tableSize <<= 1;
+    }
+    const size_t mask = tableSize - 1;
+
+    vector<uint32_t> table(tableSize, UINT32_MAX); // 대표 버텍스
+    positionIds.resize(vertices.size());
+
+    uint32_t numPositions = 0;
+    for (size_t v = 0; v < vertices.size(); v++) {
+        // -0.0f와 0.0f가 같은 해시가 되도록 0.0f를 더함
+        const Vector3 &p = vertices[v].position;
+        const float key[3] = {p.x + 0.0f, p.y + 0.0f, p.z + 0.0f};
+        uint32_t bits[3];
+        memcpy(bits, key, sizeof(bits));
+
+        size_t slot = (bits[0] * 73856093u ^ bits[1] * 19349663u ^
+                       bits[2] * 83492791u) &
+                      mask;
+        while (true) {
+            const uint32_t other = table[slot];
+            if (other == UINT32_MAX) {
+                table[slot] = uint32_t(v);
+                positionIds[v] = numPositions++;
+                break;
+            }
+            if (vertices[other].position == p) {
+                positionIds[v] = positionIds[other];
+                break;
+            }
+            slot = (slot + 1) & mask;
+        }
+    }
+
+    return numPositions;
+}
+
+// count(1~4)개 삼각형의 단위 면 노멀과 코너별 가중치
+void ComputeFaces(const vector<Vertex> &vertices, const uint32_t *indices,
+                  size_t count, NormalWeighting weighting, Vector3 normals[4],
+                  float weights[4][3]) {
+
+    Vec3x4 p[3];
+    for (int c = 0; c < 3; c++) {
+        Vector3 temp[4];
+        for (size_t k = 0; k < 4; k++) {
+            temp[k] = vertices[indices[min(k, count - 1) * 3 + c]].position;
+        }
+        p[c] = Load3x4(temp);
+    }
+
+    const Vec3x4 e01 = Sub(p[1], p[0]);
+    const Vec3x4 e02 = Sub(p[2], p[0]);
+    Vec3x4 cross = Cross(e01, e02);
+
+    // 거의 한 직선 위에 있는 삼각형은 노멀 방향이 부정확하므로 제외
+    // |e01 x e02|^2 = |e01|^2 |e02|^2 sin^2
+    const XMVECTOR degenerate = XMVectorLessOrEqual(
+        Dot(cross, cross),
+        XMVectorMultiply(XMVectorMultiply(Dot(e01, e01), Dot(e02, e02)),
+                         XMVectorReplicate(1e-12f)));
+    cross.x = XMVectorSelect(cross.x, XMVectorZero(), degenerate);
+    cross.y = XMVectorSelect(cross.y, XMVectorZero(), degenerate);
+    cross.z = XMVectorSelect(cross.z, XMVectorZero(), degenerate);
+    Store3x4(Normalize(cross), normals, count);
+
+    XMVECTOR w[3];
+    if (weighting == NormalWeighting::Area) {
+        w[0] = w[1] = w[2] = Length(cross); // 면적의 2배
+    } else {
+        const Vec3x4 n01 = Normalize(e01);
+        const Vec3x4 n02 = Normalize(e02);
+        const Vec3x4 n12 = Normalize(Sub(p[2], p[1]));
+        const XMVECTOR pi = XMVectorReplicate(XM_PI);
+        w[0] = AngleBetweenNormals(n01, n02);
+        w[1] = XMVectorSubtract(pi, AngleBetweenNormals(n01, n12));
+        w[2] = XMVectorSubtract(XMVectorSubtract(pi, w[0]), w[1]);
+    }
+
+    for (int c = 0; c < 3; c++) {
+        XMFLOAT4 temp;
+        XMStoreFloat4(&temp, w[c]);
+        const float ws[4] = {temp.x, temp.y, temp.z, temp.w};
+        for (size_t k = 0; k < count; k++) {
+            weights[k][c] = ws[k];
+        }
+    }
+}
+
+} // namespace
+
+void NormalGenerator::Generate(MeshData &meshData,
+                               const NormalOptions &options) {
+
+    vector<Vertex> &vertices = meshData.vertices;
+    vector<uint32_t> &indices = meshData.indices;
+    const size_t numTriangles = indices.size() / 3;
+
+    auto parallelFor = [&](size_t count, const function<void(size_t)> &func) {
+        if (options.parallel && count > 1) {
+            ThreadPool::Get().ParallelFor(count, func);
+        } else {
+            for (size_t i = 0; i < count; i++) {
+                func(i);
+            }
+        }
+    };
+
+    vector<uint32_t> positionIds;
+    const uint32_t numPositions = GroupByPosition(vertices, positionIds);
+
+    // 삼각형에 쓰이지 않는 버텍스
+    const Vector3 defaultNormal(0.0f, 1.0f, 0.0f);
+
+    if (options.creaseAngle >= 180.0f) {
+        // 스레드마다 따로 더할 버퍼 (개수가 정해져 있으므로 결과가 항상 같음)
+        const size_t numTasks =
+            (numTriangles + TRIANGLES_PER_TASK - 1) / TRIANGLES_PER_TASK;
+        const size_t numPartials =
+            options.parallel
+                ? max(size_t(1),
+                      min(ThreadPool::Get().NumThreads() + 1, numTasks))
+                : 1;
+        vector<vector<Vector3>> partials(numPartials);
+
+        parallelFor(numPartials, [&](size_t p) {
+            vector<Vector3> &sums = partials[p];
+            sums.assign(numPositions, Vector3(0.0f));
+
+            // 4의 배수로 나눠야 마지막 묶음만 4개보다 적음
+            const size_t numQuads = (numTriangles + 3) / 4;
+            const size_t begin = numQuads * p / numPartials * 4;
+            const size_t end =
+                min(numTriangles, numQuads * (p + 1) / numPartials * 4);
+
+            Vector3 normals[4];
+            float weights[4][3];
+            for (size_t t = begin; t < end; t += 4) {
+                const size_t count = min(size_t(4), end - t);
+                ComputeFaces(vertices, &indices[t * 3], count,
+                             options.weighting, normals, weights);
+                for (size_t k = 0; k < count; k++) {
+                    for (int c = 0; c < 3; c++) {
+                        sums[positionIds[indices[(t + k) * 3 + c]]] +=
+                            normals[k] * weights[k][c];
+                    }
+                }
+            }
+        });
+
+        // 위치 범위별로 나눠서 합침
+        vector<Vector3> &result = partials[0];
+        const size_t numPositionTasks =
+            (numPositions + ITEMS_PER_TASK - 1) / ITEMS_PER_TASK;
+        parallelFor(numPositionTasks, [&](size_t task) {
+            const size_t begin = task * ITEMS_PER_TASK;
+            const size_t end =
+                min(size_t(numPositions), begin + ITEMS_PER_TASK);
+            for (size_t q = begin; q < end; q++) {
+                for (size_t p = 1; p < numPartials; p++) {
+                    result[q] += partials[p][q];
+                }
+                if (result[q].LengthSquared() > 1e-24f) {
+                    result[q].Normalize();
+                } else {
+                    result[q] = defaultNormal;
+                }
+            }
+        });
+
+        for (size_t v = 0; v < vertices.size(); v++) {
+            vertices[v].normalModel = result[positionIds[v]];
+        }
+        return;
+    }
+
+    // 1. 면 노멀과 코너 가중치
+    vector<Vector3> faceNormals(numTriangles);
+    vector<float> cornerWeights(numTriangles * 3);
+    const size_t numTriangleTasks =
+        (numTriangles + TRIANGLES_PER_TASK - 1) / TRIANGLES_PER_TASK;
+    parallelFor(numTriangleTasks, [&](size_t task) {
+        const size_t begin = task * TRIANGLES_PER_TASK;
+        const size_t end = min(numTriangles, begin + TRIANGLES_PER_TASK);
+        Vector3 normals[4];
+        float weights[4][3];
+        for (size_t t = begin; t < end; t += 4) {
+            const size_t count = min(size_t(4), end - t);
+            ComputeFaces(vertices, &indices[t * 3], count,
+                         options.weighting, normals, weights);
+            for (size_t k = 0; k < count; k++) {
+                faceNormals[t + k] = normals[k];
+                for (int c = 0; c < 3; c++) {
+                    cornerWeights[(t + k) * 3 + c] = weights[k][c];
+                }
+            }
+        }
+    });
+
+    // 2. 위치 -> 코너 목록 (CSR)
+    vector<uint32_t> offsets(size_t(numPositions) + 1, 0);
+    for (const auto i : indices) {
+        offsets[positionIds[i] + 1]++;
+    }
+    for (size_t q = 0; q < numPositions; q++) {
+        offsets[q + 1] += offsets[q];
+    }
+    vector<uint32_t> positionCorners(numTriangles * 3);
+    {
+        vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+        for (size_t c = 0; c < numTriangles * 3; c++) {
+            positionCorners[fill[positionIds[indices[c]]]++] = uint32_t(c);
+        }
+    }
+
+    // 3. 코너마다 creaseAngle 안쪽의 면들만 평균
+    const float cosCrease =
+        cosf(XMConvertToRadians(max(options.creaseAngle, 0.0f)));
+    vector<Vector3> cornerNormals(numTriangles * 3);
+    const size_t numPositionTasks =
+        (size_t(numPositions) + ITEMS_PER_TASK - 1) / ITEMS_PER_TASK;
+    parallelFor(numPositionTasks, [&](size_t task) {
+        const size_t begin = task * ITEMS_PER_TASK;
+        const size_t end = min(size_t(numPositions), begin + ITEMS_PER_TASK);
+        for (size_t q = begin; q < end; q++) {
+            for (uint32_t a = offsets[q]; a < offsets[q + 1]; a++) {
+                const uint32_t c = positionCorners[a];
+                const Vector3 &faceNormal = faceNormals[c / 3];
+
+                Vector3 sum(0.0f), all(0.0f);
+                for (uint32_t b = offsets[q]; b < offsets[q + 1]; b++) {
+                    const uint32_t other = positionCorners[b];
+                    const Vector3 n =
+                        faceNormals[other / 3] * cornerWeights[other];
+                    all += n;
+                    if (faceNormal.Dot(faceNormals[other / 3]) >=
+                        cosCrease) {
+                        sum += n;
+                    }
+                }
+
+                // 면적이 0인 삼각형은 주변 전체의 평균
+                if (sum.LengthSquared() <= 1e-24f) {
+                    sum = all;
+                }
+                if (sum.LengthSquared() > 1e-24f) {
+                    sum.Normalize();
+                } else {
+                    sum = defaultNormal;
+                }
+                cornerNormals[c] = sum;
+            }
+        }
+    });
+
+    // 4. 한 버텍스의 코너들이 서로 다른 노멀을 가지면 버텍스 복제
+    const size_t numOriginal = vertices.size();
+    vector<bool> assigned(numOriginal, false);
+    vector<uint32_t> nextCopy(numOriginal, UINT32_MAX); // 복제본 연결 리스트
+    for (size_t c = 0; c < numTriangles * 3; c++) {
+        const uint32_t v = indices[c];
+        const Vector3 &n = cornerNormals[c];
+        if (!assigned[v]) {
+            assigned[v] = true;
+            vertices[v].normalModel = n;
+            continue;
+        }
+
+        uint32_t u = v;
+        while (true) {
+            if (vertices[u].normalModel.Dot(n) > 0.9999f) {
+                indices[c] = u;
+                break;
+            }
+            if (nextCopy[u] == UINT32_MAX) {
+                Vertex copy = vertices[v];
+                copy.normalModel = n;
+                nextCopy[u] = uint32_t(vertices.size());
+                indices[c] = uint32_t(vertices.size());
+                vertices.push_back(copy);
+                nextCopy.push_back(UINT32_MAX);
+                break;
+            }
+            u = nextCopy[u];
+        }
+    }
+
+    for (size_t v = 0; v < numOriginal; v++) {
+        if (!assigned[v]) {
+            vertices[v].normalModel = defaultNormal;
+        }
+    }
+}
+
+bool NormalGenerator::NeedsNormals(const MeshData &meshData) {
+    for (const auto &v : meshData.vertices) {
+        const float lengthSq = v.normalModel.LengthSquared();
+        if (!(lengthSq > 1e-12f) || !isfinite(lengthSq)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace Moon
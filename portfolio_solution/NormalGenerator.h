@@ -0,0 +1,39 @@
+#pragma once
+
+#include "MeshData.h"
+
+namespace Moon {
+
+// 노멀이 없거나 쓸 수 없는 메쉬의 버텍스 노멀을 계산
+// 위치가 같은 버텍스들(UV 경계 등)은 같은 노멀을 갖도록 위치 단위로 합산
+// 참고: DirectXMesh ComputeNormals
+// https://github.com/microsoft/DirectXMesh/wiki/ComputeNormals
+// 참고: Thürmer and Wüthrich, "Computing Vertex Normals from Polygonal
+// Facets" (1998) - 각도 가중치
+
+// 1. 삼각형 4개씩 SoA로 묶어서 SIMD로 면 노멀 계산
+// 2. 삼각형 범위를 스레드 개수만큼 나누고 각자의 버퍼에 더한 후
+//    정해진 순서로 합침 (atomic 없음, 결과는 실행 순서와 무관)
+// 3. creaseAngle보다 크게 꺾인 모서리에서는 버텍스를 복제해서 노멀을 나눔
+
+enum class NormalWeighting {
+    Area, // 면적이 큰 삼각형의 영향이 큼
+    Angle // 버텍스에서의 코너 각도 (삼각형 분할 방식에 덜 민감)
+};
+
+struct NormalOptions {
+    NormalWeighting weighting = NormalWeighting::Angle;
+    float creaseAngle = 180.0f; // 단위: 도, 180이면 나누지 않음
+    bool parallel = true;
+};
+
+class NormalGenerator {
+  public:
+    static void Generate(MeshData &meshData,
+                         const NormalOptions &options = NormalOptions());
+
+    // 노멀이 0 벡터이거나 NaN인 버텍스가 있으면 true
+    static bool NeedsNormals(const MeshData &meshData);
+};
+
+} // namespace Moon
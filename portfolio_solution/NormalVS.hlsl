@@ -1,13 +1,35 @@
 #include "Common.hlsli"
 
+cbuffer MeshConstants : register(b0)
+{
+    matrix world;
+    matrix worldIT;
+    int useHeightMap;
+    float heightScale;
+    float2 dummy;
+    float3 positionMin;    // PackedVertex의 위치 복원
+    float dummy1;
+    float3 positionExtent;
+    float dummy2;
+};
+
 struct NormalGeometryShaderInput
 {
     float4 posModel : SV_POSITION;
     float3 normalWorld : NORMAL;
 };
 
+#ifdef PACKED_VERTEX
+NormalGeometryShaderInput main(PackedVertexShaderInput packedInput)
+#else
 NormalGeometryShaderInput main(VertexShaderInput input)
+#endif
 {
+#ifdef PACKED_VERTEX
+    VertexShaderInput input =
+        UnpackVertex(packedInput, positionMin, positionExtent);
+#endif
+
     NormalGeometryShaderInput output;
 
     output.posModel = float4(input.posModel, 1.0);
@@ -0,0 +1,358 @@
+#include "OcclusionCuller.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <xmmintrin.h>
+
+#include "ThreadPool.h"
+
+namespace Moon {
+
+using namespace std;
+using DirectX::BoundingBox;
+using DirectX::SimpleMath::Vector4;
+
+namespace {
+
+constexpr int BLOCK_SIZE = 8; // 계층 깊이 버퍼의 블록
+constexpr int TILE_WIDTH = 64; // 작업 스레드 하나가 맡는 영역
+constexpr int TILE_HEIGHT = 32;
+
+} // namespace
+
+shared_ptr<OccluderMesh> OcclusionCuller::MakeOccluder(
+    const vector<MeshData> &meshes, int lod) {
+
+    auto occluder = make_shared<OccluderMesh>();
+    for (const auto &meshData : meshes) {
+        const uint32_t base = uint32_t(occluder->positions.size());
+        for (const auto &v : meshData.vertices) {
+            occluder->positions.push_back(v.position);
+        }
+        const bool hasLod =
+            lod > 0 && size_t(lod) <= meshData.lodIndices.size();
+        const auto &indices =
+            hasLod ? meshData.lodIndices[lod - 1] : meshData.indices;
+        for (const uint32_t i : indices) {
+            occluder->indices.push_back(base + i);
+        }
+    }
+    return occluder;
+}
+
+void OcclusionCuller::Begin(const Matrix &viewProjRow,
+                            const OcclusionOptions &options) {
+
+    m_options = options;
+    m_viewProjRow = viewProjRow;
+    m_viewProjFlipped = viewProjRow.Determinant() < 0.0f; // 반사 행렬 포함
+    m_width = (std::max(options.width, 8) + 7) / 8 * 8;
+    m_height = (std::max(options.height, 8) + 7) / 8 * 8;
+    m_tilesX = (m_width + TILE_WIDTH - 1) / TILE_WIDTH;
+    m_tilesY = (m_height + TILE_HEIGHT - 1) / TILE_HEIGHT;
+
+    m_depth.resize(size_t(m_width) * m_height);
+    m_hiZ.resize(size_t(m_width / BLOCK_SIZE) * (m_height / BLOCK_SIZE));
+    m_triangles.clear();
+    m_tileTriangles.resize(size_t(m_tilesX) * m_tilesY);
+    for (auto &t : m_tileTriangles) {
+        t.clear();
+    }
+
+    m_stats = Stats();
+}
+
+void OcclusionCuller::AddOccluder(const OccluderMesh &mesh,
+                                  const Matrix &worldRow) {
+
+    m_stats.numOccluders++;
+
+    // 음수 스케일로 뒤집힌 물체와 거울 시점이 겹치면 다시 원래 방향
+    m_flipWinding = m_viewProjFlipped != (worldRow.Determinant() < 0.0f);
+
+    // 버텍스마다 한 번만 변환 (가까운 평면 뒤의 점은 화면 좌표도 미리)
+    const Matrix worldViewProjRow = worldRow * m_viewProjRow;
+    m_clip.resize(mesh.positions.size());
+    m_screen.resize(mesh.positions.size());
+    for (size_t i = 0; i < m_clip.size(); i++) {
+        m_clip[i] = Vector4::Transform(
+            Vector4(mesh.positions[i].x, mesh.positions[i].y,
+                    mesh.positions[i].z, 1.0f),
+            worldViewProjRow);
+        if (m_clip[i].z >= 0.0f) {
+            m_screen[i] = ToScreen(m_clip[i]);
+        }
+    }
+
+    for (size_t t = 0; t + 2 < mesh.indices.size(); t += 3) {
+        const uint32_t i0 = mesh.indices[t];
+        const uint32_t i1 = mesh.indices[t + 1];
+        const uint32_t i2 = mesh.indices[t + 2];
+        const Vector4 v[3] = {m_clip[i0], m_clip[i1], m_clip[i2]};
+
+        // 세 점이 모두 한 평면 밖이면 버림 (z < 0은 가까운 평면 앞)
+        if ((v[0].x > v[0].w && v[1].x > v[1].w && v[2].x > v[2].w) ||
+            (v[0].x < -v[0].w && v[1].x < -v[1].w && v[2].x < -v[2].w) ||
+            (v[0].y > v[0].w && v[1].y > v[1].w && v[2].y > v[2].w) ||
+            (v[0].y < -v[0].w && v[1].y < -v[1].w && v[2].y < -v[2].w) ||
+            (v[0].z < 0.0f && v[1].z < 0.0f && v[2].z < 0.0f)) {
+            continue;
+        }
+
+        if (v[0].z >= 0.0f && v[1].z >= 0.0f && v[2].z >= 0.0f) {
+            const Vector3 screen[3] = {m_screen[i0], m_screen[i1],
+                                       m_screen[i2]};
+            AddTriangle(screen);
+            continue;
+        }
+
+        // 가까운 평면(z = 0)으로 잘라서 사각형이면 삼각형 두 개
+        Vector3 polygon[4];
+        int count = 0;
+        for (int k = 0; k < 3; k++) {
+            const Vector4 &a = v[k];
+            const Vector4 &b = v[(k + 1) % 3];
+            if (a.z >= 0.0f) {
+                polygon[count++] = ToScreen(a);
+            }
+            if ((a.z >= 0.0f) != (b.z >= 0.0f)) {
+                polygon[count++] =
+                    ToScreen(a + (b - a) * (a.z / (a.z - b.z)));
+            }
+        }
+        for (int k = 1; k + 1 < count; k++) {
+            const Vector3 fan[3] = {polygon[0], polygon[k], polygon[k + 1]};
+            AddTriangle(fan);
+        }
+    }
+}
+
+Vector3 OcclusionCuller::ToScreen(const Vector4 &clip) const {
+    const float invW = 1.0f / clip.w;
+    return Vector3((clip.x * invW * 0.5f + 0.5f) * m_width,
+                   (0.5f - clip.y * invW * 0.5f) * m_height, clip.z * invW);
+}
+
+void OcclusionCuller::AddTriangle(const Vector3 screen[3]) {
+
+    ScreenTriangle tri;
+    for (int k = 0; k < 3; k++) {
+        tri.x[k] = screen[k].x;
+        tri.y[k] = screen[k].y;
+        tri.z[k] = screen[k].z;
+    }
+
+    // GPU와 같이 뒷면은 그리지 않음 (화면에서 시계 방향이 앞면)
+    // 거울 시점이나 뒤집힌 물체는 AddOccluder()에서 정한 m_flipWinding대로
+    // 반대 방향을 앞면으로 봄
+    const float area = (tri.x[1] - tri.x[0]) * (tri.y[2] - tri.y[0]) -
+                       (tri.x[2] - tri.x[0]) * (tri.y[1] - tri.y[0]);
+    if (m_flipWinding ? area > -1e-6f : area < 1e-6f) {
+        return;
+    }
+    if (m_flipWinding) {
+        std::swap(tri.x[1], tri.x[2]);
+        std::swap(tri.y[1], tri.y[2]);
+        std::swap(tri.z[1], tri.z[2]);
+    }
+
+    // 픽셀 중심을 하나도 덮지 않으면 버림
+    int x0, x1, y0, y1;
+    if (!PixelBounds(tri, 0, m_width, 0, m_height, x0, x1, y0, y1)) {
+        return;
+    }
+
+    const uint32_t index = uint32_t(m_triangles.size());
+    m_triangles.push_back(tri);
+    for (int ty = y0 / TILE_HEIGHT; ty <= (y1 - 1) / TILE_HEIGHT; ty++) {
+        for (int tx = x0 / TILE_WIDTH; tx <= (x1 - 1) / TILE_WIDTH; tx++) {
+            m_tileTriangles[ty * m_tilesX + tx].push_back(index);
+        }
+    }
+}
+
+bool OcclusionCuller::PixelBounds(const ScreenTriangle &tri, int minX,
+                                  int maxX, int minY, int maxY, int &x0,
+                                  int &x1, int &y0, int &y1) {
+    // 중심 (x + 0.5, y + 0.5)이 삼각형의 상자 안에 있는 픽셀 [x0, x1)
+    const float left = std::min({tri.x[0], tri.x[1], tri.x[2]});
+    const float right = std::max({tri.x[0], tri.x[1], tri.x[2]});
+    const float top = std::min({tri.y[0], tri.y[1], tri.y[2]});
+    const float bottom = std::max({tri.y[0], tri.y[1], tri.y[2]});
+    x0 = int(std::max(std::ceil(left - 0.5f), float(minX)));
+    x1 = int(std::min(std::floor(right - 0.5f) + 1.0f, float(maxX)));
+    y0 = int(std::max(std::ceil(top - 0.5f), float(minY)));
+    y1 = int(std::min(std::floor(bottom - 0.5f) + 1.0f, float(maxY)));
+    return x0 < x1 && y0 < y1;
+}
+
+void OcclusionCuller::Rasterize() {
+
+    m_stats.numTriangles = m_triangles.size();
+    ThreadPool::Get().ParallelFor(
+        m_tileTriangles.size(), [&](size_t tile) { RasterizeTile(int(tile)); });
+}
+
+void OcclusionCuller::RasterizeTile(int tile) {
+
+    const int x0 = (tile % m_tilesX) * TILE_WIDTH;
+    const int y0 = (tile / m_tilesX) * TILE_HEIGHT;
+    const int x1 = std::min(x0 + TILE_WIDTH, m_width);
+    const int y1 = std::min(y0 + TILE_HEIGHT, m_height);
+
+    for (int y = y0; y < y1; y++) {
+        std::fill(m_depth.begin() + size_t(y) * m_width + x0,
+                  m_depth.begin() + size_t(y) * m_width + x1, 1.0f);
+    }
+
+    const __m128 laneOffset = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    const __m128 zero = _mm_setzero_ps();
+
+    for (const uint32_t index : m_tileTriangles[tile]) {
+        const ScreenTriangle &tri = m_triangles[index];
+
+        // 픽셀 중심 (x + 0.5, y + 0.5)이 안쪽이면 그림
+        int minX, maxX, minY, maxY;
+        if (!PixelBounds(tri, x0, x1, y0, y1, minX, maxX, minY, maxY)) {
+            continue;
+        }
+
+        // 변 k의 함수 e = a * x + b * y + c (안쪽이 양수)
+        float a[3], b[3], c[3];
+        for (int k = 0; k < 3; k++) {
+            const int k1 = (k + 1) % 3;
+            a[k] = tri.y[k] - tri.y[k1];
+            b[k] = tri.x[k1] - tri.x[k];
+            c[k] = -(a[k] * tri.x[k] + b[k] * tri.y[k]);
+        }
+
+        // 깊이는 화면 공간에서 선형 (z = zA * x + zB * y + zC)
+        const float area = a[1] * tri.x[0] + b[1] * tri.y[0] + c[1];
+        const float invArea = 1.0f / area;
+        const float zA = (a[1] * tri.z[0] + a[2] * tri.z[1] + a[0] * tri.z[2]) *
+                         invArea;
+        const float zB = (b[1] * tri.z[0] + b[2] * tri.z[1] + b[0] * tri.z[2]) *
+                         invArea;
+        const float zC = (c[1] * tri.z[0] + c[2] * tri.z[1] + c[0] * tri.z[2]) *
+                         invArea;
+
+        const int startX = minX & ~3; // 4픽셀 단위로 정렬
+        const __m128 xs =
+            _mm_add_ps(_mm_set1_ps(float(startX)), laneOffset);
+        __m128 edgeX[3], edgeStep[3];
+        for (int k = 0; k < 3; k++) {
+            edgeX[k] = _mm_mul_ps(_mm_set1_ps(a[k]), xs);
+            edgeStep[k] = _mm_set1_ps(a[k] * 4.0f);
+        }
+        const __m128 zX = _mm_mul_ps(_mm_set1_ps(zA), xs);
+        const __m128 zStep = _mm_set1_ps(zA * 4.0f);
+
+        for (int y = minY; y < maxY; y++) {
+            const float py = y + 0.5f;
+            __m128 e[3];
+            for (int k = 0; k < 3; k++) {
+                e[k] = _mm_add_ps(edgeX[k], _mm_set1_ps(b[k] * py + c[k]));
+            }
+            __m128 z = _mm_add_ps(zX, _mm_set1_ps(zB * py + zC));
+
+            float *row = &m_depth[size_t(y) * m_width];
+            for (int x = startX; x < maxX; x += 4) {
+                const __m128 inside = _mm_and_ps(
+                    _mm_and_ps(_mm_cmpge_ps(e[0], zero),
+                               _mm_cmpge_ps(e[1], zero)),
+                    _mm_cmpge_ps(e[2], zero));
+                if (_mm_movemask_ps(inside)) {
+                    const __m128 depth = _mm_loadu_ps(row + x);
+                    const __m128 closer = _mm_min_ps(depth, z);
+                    _mm_storeu_ps(row + x,
+                                  _mm_or_ps(_mm_and_ps(inside, closer),
+                                            _mm_andnot_ps(inside, depth)));
+                }
+                for (int k = 0; k < 3; k++) {
+                    e[k] = _mm_add_ps(e[k], edgeStep[k]);
+                }
+                z = _mm_add_ps(z, zStep);
+            }
+        }
+    }
+
+    // 블록마다 가장 먼 깊이
+    const int blocksX = m_width / BLOCK_SIZE;
+    for (int by = y0 / BLOCK_SIZE; by < y1 / BLOCK_SIZE; by++) {
+        for (int bx = x0 / BLOCK_SIZE; bx < x1 / BLOCK_SIZE; bx++) {
+            __m128 farthest = _mm_setzero_ps();
+            for (int y = by * BLOCK_SIZE; y < (by + 1) * BLOCK_SIZE; y++) {
+                const float *row = &m_depth[size_t(y) * m_width + bx * 8];
+                farthest = _mm_max_ps(farthest, _mm_loadu_ps(row));
+                farthest = _mm_max_ps(farthest, _mm_loadu_ps(row + 4));
+            }
+            farthest = _mm_max_ps(
+                farthest, _mm_shuffle_ps(farthest, farthest, 0x4e));
+            farthest = _mm_max_ps(
+                farthest, _mm_shuffle_ps(farthest, farthest, 0xb1));
+            m_hiZ[by * blocksX + bx] = _mm_cvtss_f32(farthest);
+        }
+    }
+}
+
+bool OcclusionCuller::IsOccluded(const BoundingBox &box) {
+
+    m_stats.numTested++;
+
+    // 8개 꼭짓점의 화면 영역과 가장 가까운 깊이
+    Vector3 corners[8];
+    box.GetCorners(corners);
+    float minX = FLT_MAX, maxX = -FLT_MAX;
+    float minY = FLT_MAX, maxY = -FLT_MAX;
+    float minZ = FLT_MAX;
+    for (const auto &corner : corners) {
+        const Vector4 clip = Vector4::Transform(
+            Vector4(corner.x, corner.y, corner.z, 1.0f), m_viewProjRow);
+        if (clip.z < 0.0f) {
+            return false; // 가까운 평면에 걸침
+        }
+        const float invW = 1.0f / clip.w;
+        const float x = (clip.x * invW * 0.5f + 0.5f) * m_width;
+        const float y = (0.5f - clip.y * invW * 0.5f) * m_height;
+        minX = std::min(minX, x);
+        maxX = std::max(maxX, x);
+        minY = std::min(minY, y);
+        maxY = std::max(maxY, y);
+        minZ = std::min(minZ, clip.z * invW);
+    }
+
+    // 걸친 픽셀을 모두 포함하도록 바깥으로 반올림
+    const int x0 = std::max(int(std::floor(minX)), 0);
+    const int x1 = std::min(int(std::ceil(maxX)), m_width);
+    const int y0 = std::max(int(std::floor(minY)), 0);
+    const int y1 = std::min(int(std::ceil(maxY)), m_height);
+    if (x0 >= x1 || y0 >= y1) {
+        return false;
+    }
+
+    const int blocksX = m_width / BLOCK_SIZE;
+    for (int by = y0 / BLOCK_SIZE; by <= (y1 - 1) / BLOCK_SIZE; by++) {
+        for (int bx = x0 / BLOCK_SIZE; bx <= (x1 - 1) / BLOCK_SIZE; bx++) {
+            if (m_hiZ[by * blocksX + bx] < minZ) {
+                continue; // 블록 전체가 상자보다 가까움
+            }
+            const int py0 = std::max(y0, by * BLOCK_SIZE);
+            const int py1 = std::min(y1, (by + 1) * BLOCK_SIZE);
+            const int px0 = std::max(x0, bx * BLOCK_SIZE);
+            const int px1 = std::min(x1, (bx + 1) * BLOCK_SIZE);
+            for (int y = py0; y < py1; y++) {
+                for (int x = px0; x < px1; x++) {
+                    if (m_depth[size_t(y) * m_width + x] >= minZ) {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+
+    m_stats.numOccluded++;
+    return true;
+}
+
+} // namespace Moon
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <DirectXCollision.h>
+#include <directxtk/SimpleMath.h>
+#include <memory>
+#include <vector>
+
+#include "MeshData.h"
+
+namespace Moon {
+
+using DirectX::SimpleMath::Matrix;
+using DirectX::SimpleMath::Vector3;
+
+// 가리는 물체로 그릴 삼각형 (모델 좌표계, 원본 LOD0)
+// 간략화된 LOD는 원래 표면보다 안쪽으로 들어갈 수 있어서 보수적이지 않음
+struct OccluderMesh {
+    std::vector<Vector3> positions;
+    std::vector<uint32_t> indices;
+};
+
+struct OcclusionOptions {
+    int width = 320; // 깊이 버퍼 해상도 (8의 배수로 올림)
+    int height = 192;
+    int maxOccluders = 8;         // 프레임마다 그리는 가리는 물체 개수
+    float minOccluderSize = 0.1f; // 화면 높이 대비 크기가 이보다 크면 후보
+};
+
+// CPU에서 저해상도 깊이 버퍼에 큰 물체 몇 개만 그리고
+// 나머지 물체들의 AABB가 그 뒤에 완전히 가려지는지 검사
+// 1. AddOccluder(): 삼각형을 변환하고 가까운 평면으로 자른 후 타일별로 분류
+// 2. Rasterize(): 타일마다 작업 스레드에서 SSE로 4픽셀씩 그리고
+//    8x8 블록마다 가장 먼 깊이를 모아 둠 (계층 깊이 버퍼)
+// 3. IsOccluded(): 상자의 화면 영역과 가장 가까운 깊이를 블록과 먼저 비교하고
+//    결정이 안 되는 블록만 픽셀 단위로 비교
+// 깊이는 NDC z [0, 1] (가까울수록 작음)
+// 참고: Hasselgren et al. "Masked Software Occlusion Culling" (HPG 2016)
+// https://github.com/GameTechDev/MaskedOcclusionCulling
+
+class OcclusionCuller {
+  public:
+    struct Stats {
+        size_t numOccluders = 0;
+        size_t numTriangles = 0; // 잘라내고 남은 가리는 삼각형
+        size_t numTested = 0;
+        size_t numOccluded = 0;
+    };
+
+    // meshes의 lod 단계 인덱스로 만듦 (없으면 LOD0)
+    static std::shared_ptr<OccluderMesh>
+    MakeOccluder(const std::vector<MeshData> &meshes, int lod = 0);
+
+    void Begin(const Matrix &viewProjRow,
+               const OcclusionOptions &options = OcclusionOptions());
+
+    void AddOccluder(const OccluderMesh &mesh, const Matrix &worldRow);
+
+    void Rasterize();
+
+    // 보수적: 확실히 가려졌을 때만 true
+    bool IsOccluded(const DirectX::BoundingBox &box);
+
+    Stats GetStats() const { return m_stats; }
+
+  private:
+    struct ScreenTriangle {
+        float x[3]; // 픽셀 좌표
+        float y[3];
+        float z[3];
+    };
+
+    Vector3 ToScreen(const DirectX::SimpleMath::Vector4 &clip) const;
+    void AddTriangle(const Vector3 screen[3]); // (픽셀 x, 픽셀 y, 깊이)
+    void RasterizeTile(int tile);
+
+    // [minX, maxX) x [minY, maxY) 안에서 삼각형 상자에 중심이 들어가는 픽셀들
+    static bool PixelBounds(const ScreenTriangle &tri, int minX, int maxX,
+                            int minY, int maxY, int &x0, int &x1, int &y0,
+                            int &y1);
+
+    OcclusionOptions m_options;
+    Matrix m_viewProjRow;
+    int m_width = 0;
+    int m_height = 0;
+    int m_tilesX = 0;
+    int m_tilesY = 0;
+    bool m_viewProjFlipped = false; // Begin()의 행렬에 반사가 들어 있는지
+    bool m_flipWinding = false;     // 지금 AddOccluder() 중인 물체 기준
+
+    std::vector<float> m_depth; // m_width x m_height
+    std::vector<float> m_hiZ;   // 8x8 블록마다 가장 먼 깊이
+    std::vector<ScreenTriangle> m_triangles;
+    std::vector<std::vector<uint32_t>> m_tileTriangles; // 타일별 삼각형
+
+    // AddOccluder()에서 재사용하는 버텍스 변환 결과
+    std::vector<DirectX::SimpleMath::Vector4> m_clip;
+    std::vector<Vector3> m_screen;
+
+    Stats m_stats;
+};
+
+} // namespace Moon
@@ -1,4 +1,5 @@
 #include "PostProcess.h"
+#include "GeometryRegistry.h"
 #include "GraphicsCommon.h"
 
 namespace Moon {
@@ -9,14 +10,16 @@ void PostProcess::Initialize(
     const std::vector<ComPtr<ID3D11RenderTargetView>> &targets, const int width,
     const int height, const int bloomLevels) {
 
-    MeshData meshData = GeometryGenerator::MakeSquare();
+    // ExampleApp의 화면 사각형과 같은 지오메트리를 공유
+    auto geometry = GeometryRegistry::Get().GetOrCreate(
+        device, GeometryRegistry::MakeKey("MakeSquare", {1.0f}),
+        [] { return GeometryGenerator::MakeSquare(); });
 
     m_mesh = std::make_shared<Mesh>();
-    D3D11Utils::CreateVertexBuffer(device, meshData.vertices,
-                                   m_mesh->vertexBuffer);
-    m_mesh->indexCount = UINT(meshData.indices.size());
-    D3D11Utils::CreateIndexBuffer(device, meshData.indices,
-                                  m_mesh->indexBuffer);
+    m_mesh->geometry = geometry;
+    m_mesh->vertexBuffer = geometry->vertexBuffer;
+    m_mesh->indexBuffer = geometry->indexBuffer;
+    m_mesh->indexCount = geometry->indexCount;
 
     // Bloom Down/Up
     m_bloomSRVs.resize(bloomLevels);
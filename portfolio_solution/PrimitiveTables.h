@@ -0,0 +1,170 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+#include "Vertex.h"
+
+namespace Moon {
+
+// 크기가 정해진 도형의 버텍스/인덱스 테이블
+// 모두 컴파일 타임에 만들어지므로 실행 중에는 복사와 크기 조절만 필요
+template <size_t NumVertices, size_t NumIndices> struct PrimitiveTable {
+    std::array<Vertex, NumVertices> vertices;
+    std::array<uint32_t, NumIndices> indices;
+};
+
+namespace PrimitiveTables {
+
+// 컴파일 타임 sqrt (뉴턴 방법)
+constexpr float Sqrt(const float x) {
+    if (x <= 0.0f) {
+        return 0.0f;
+    }
+    double r = x > 1.0f ? x : 1.0;
+    for (int i = 0; i < 32; i++) {
+        r = 0.5 * (r + x / r);
+    }
+    return float(r);
+}
+
+constexpr Vector3 Normalized(const float x, const float y, const float z) {
+    const float length = Sqrt(x * x + y * y + z * z);
+    return Vector3(x / length, y / length, z / length);
+}
+
+// Vertex는 기본 생성자가 constexpr이 아니므로 배열을 한 번에 초기화
+template <size_t N, typename F, size_t... I>
+constexpr std::array<Vertex, N> MakeVertices(F makeVertex,
+                                             std::index_sequence<I...>) {
+    return {{makeVertex(I)...}};
+}
+
+template <size_t N, typename F>
+constexpr std::array<Vertex, N> MakeVertices(F makeVertex) {
+    return MakeVertices<N>(makeVertex, std::make_index_sequence<N>());
+}
+
+// Texture Coordinates (Direct3D 9)
+// https://learn.microsoft.com/en-us/windows/win32/direct3d9/texture-coordinates
+constexpr float quadTexcoords[4][2] = {
+    {0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}};
+
+// 정사각형 (-1 ~ 1, 앞면이 -z 방향)
+constexpr PrimitiveTable<4, 6> square = {
+    MakeVertices<4>([](size_t i) {
+        constexpr float positions[4][2] = {
+            {-1.0f, 1.0f}, {1.0f, 1.0f}, {1.0f, -1.0f}, {-1.0f, -1.0f}};
+        return Vertex{Vector3(positions[i][0], positions[i][1], 0.0f),
+                      Vector3(0.0f, 0.0f, -1.0f),
+                      Vector2(quadTexcoords[i][0], quadTexcoords[i][1]),
+                      Vector3(1.0f, 0.0f, 0.0f)};
+    }),
+    {0, 1, 2, 0, 2, 3}};
+
+// 상자 (-1 ~ 1), 면마다 버텍스 4개
+// 탄젠트는 각 면의 0번 -> 1번 버텍스 방향 (텍스춰 좌표 u 방향)
+constexpr float boxPositions[24][3] = {
+    {-1.0f, 1.0f, -1.0f},  {-1.0f, 1.0f, 1.0f},   {1.0f, 1.0f, 1.0f},
+    {1.0f, 1.0f, -1.0f},   // 윗면
+    {-1.0f, -1.0f, -1.0f}, {1.0f, -1.0f, -1.0f},  {1.0f, -1.0f, 1.0f},
+    {-1.0f, -1.0f, 1.0f},  // 아랫면
+    {-1.0f, -1.0f, -1.0f}, {-1.0f, 1.0f, -1.0f},  {1.0f, 1.0f, -1.0f},
+    {1.0f, -1.0f, -1.0f},  // 앞면
+    {-1.0f, -1.0f, 1.0f},  {1.0f, -1.0f, 1.0f},   {1.0f, 1.0f, 1.0f},
+    {-1.0f, 1.0f, 1.0f},   // 뒷면
+    {-1.0f, -1.0f, 1.0f},  {-1.0f, 1.0f, 1.0f},   {-1.0f, 1.0f, -1.0f},
+    {-1.0f, -1.0f, -1.0f}, // 왼쪽
+    {1.0f, -1.0f, 1.0f},   {1.0f, -1.0f, -1.0f},  {1.0f, 1.0f, -1.0f},
+    {1.0f, 1.0f, 1.0f}};   // 오른쪽
+
+constexpr float boxNormals[6][3] = {{0.0f, 1.0f, 0.0f},  {0.0f, -1.0f, 0.0f},
+                                    {0.0f, 0.0f, -1.0f}, {0.0f, 0.0f, 1.0f},
+                                    {-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}};
+
+constexpr PrimitiveTable<24, 36> box = {
+    MakeVertices<24>([](size_t i) {
+        const float *p = boxPositions[i];
+        const float *n = boxNormals[i / 4];
+        const float *p0 = boxPositions[i / 4 * 4];
+        const float *p1 = boxPositions[i / 4 * 4 + 1];
+        return Vertex{Vector3(p[0], p[1], p[2]), Vector3(n[0], n[1], n[2]),
+                      Vector2(quadTexcoords[i % 4][0], quadTexcoords[i % 4][1]),
+                      Vector3((p1[0] - p0[0]) * 0.5f, (p1[1] - p0[1]) * 0.5f,
+                              (p1[2] - p0[2]) * 0.5f)};
+    }),
+    {
+        0,  1,  2,  0,  2,  3,  // 윗면
+        4,  5,  6,  4,  6,  7,  // 아랫면
+        8,  9,  10, 8,  10, 11, // 앞면
+        12, 13, 14, 12, 14, 15, // 뒷면
+        16, 17, 18, 16, 18, 19, // 왼쪽
+        20, 21, 22, 20, 22, 23  // 오른쪽
+    }};
+
+// 정사면체 (한 변의 길이 1, 중심이 원점)
+// https://mathworld.wolfram.com/RegularTetrahedron.html
+constexpr float tetraX = Sqrt(3.0f) / 3.0f;
+constexpr float tetraD = Sqrt(3.0f) / 6.0f; // = x / 2
+constexpr float tetraH = Sqrt(6.0f) / 3.0f;
+
+// 네 점의 평균이 (0, 0, h / 4)이므로 z에서 빼줌
+constexpr float tetraPositions[4][3] = {
+    {0.0f, tetraX, -0.25f * tetraH},
+    {-0.5f, -tetraD, -0.25f * tetraH},
+    {0.5f, -tetraD, -0.25f * tetraH},
+    {0.0f, 0.0f, 0.75f * tetraH}};
+
+constexpr PrimitiveTable<4, 12> tetrahedron = {
+    MakeVertices<4>([](size_t i) {
+        const float *p = tetraPositions[i];
+        return Vertex{Vector3(p[0], p[1], p[2]),
+                      Normalized(p[0], p[1], p[2]), // 중심이 원점
+                      Vector2(0.0f, 0.0f), Vector3(0.0f, 0.0f, 0.0f)};
+    }),
+    {0, 1, 2, 3, 2, 1, 0, 3, 1, 0, 2, 3}};
+
+// 정20면체 (Luna DX12 교재 참고)
+// https://mathworld.wolfram.com/Isohedron.html
+constexpr float icosaX = 0.525731f;
+constexpr float icosaZ = 0.850651f;
+
+constexpr float icosaPositions[12][3] = {
+    {-icosaX, 0.0f, icosaZ},  {icosaX, 0.0f, icosaZ},
+    {-icosaX, 0.0f, -icosaZ}, {icosaX, 0.0f, -icosaZ},
+    {0.0f, icosaZ, icosaX},   {0.0f, icosaZ, -icosaX},
+    {0.0f, -icosaZ, icosaX},  {0.0f, -icosaZ, -icosaX},
+    {icosaZ, icosaX, 0.0f},   {-icosaZ, icosaX, 0.0f},
+    {icosaZ, -icosaX, 0.0f},  {-icosaZ, -icosaX, 0.0f}};
+
+constexpr PrimitiveTable<12, 60> icosahedron = {
+    MakeVertices<12>([](size_t i) {
+        const float *p = icosaPositions[i];
+        return Vertex{Vector3(p[0], p[1], p[2]), Normalized(p[0], p[1], p[2]),
+                      Vector2(0.0f, 0.0f), Vector3(0.0f, 0.0f, 0.0f)};
+    }),
+    {1,  4,  0, 4,  9, 0, 4, 5,  9, 8, 5, 4,  1,  8, 4,
+     1,  10, 8, 10, 3, 8, 8, 3,  5, 3, 2, 5,  3,  7, 2,
+     3,  10, 7, 10, 6, 7, 6, 11, 7, 6, 0, 11, 6,  1, 0,
+     10, 1,  6, 11, 0, 9, 2, 11, 9, 5, 2, 9,  11, 2, 7}};
+
+// 원기둥 옆면의 인덱스 (아래쪽 링 numSlices + 1개, 위쪽 링 numSlices + 1개)
+template <int numSlices>
+constexpr std::array<uint32_t, 6 * numSlices> CylinderIndices() {
+    std::array<uint32_t, 6 * numSlices> indices = {};
+    for (uint32_t i = 0; i < uint32_t(numSlices); i++) {
+        const uint32_t top = i + numSlices + 1;
+        indices[6 * i] = i;
+        indices[6 * i + 1] = top;
+        indices[6 * i + 2] = top + 1;
+        indices[6 * i + 3] = i;
+        indices[6 * i + 4] = top + 1;
+        indices[6 * i + 5] = i + 1;
+    }
+    return indices;
+}
+
+} // namespace PrimitiveTables
+
+} // namespace Moon
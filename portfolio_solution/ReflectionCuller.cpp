@@ -0,0 +1,109 @@
+#include "ReflectionCuller.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#include "Camera.h"
+
+namespace Moon {
+
+using namespace std;
+
+ReflectionView ReflectionCuller::Compute(const DirectX::BoundingBox &mirrorBox,
+                                         const Plane &mirrorPlane,
+                                         const Vector3 &eyeWorld,
+                                         const Matrix &viewRow,
+                                         const Matrix &projRow,
+                                         int screenWidth, int screenHeight) {
+    ReflectionView view;
+
+    // 거울 뒤에서는 거울 앞면이 보이지 않음
+    Plane plane = mirrorPlane;
+    plane.Normalize();
+    if (plane.DotCoordinate(eyeWorld) <= 0.0f) {
+        return view;
+    }
+
+    // 1. AABB 꼭지점 8개 (비트 0, 1, 2가 x, y, z의 +/-)
+    const Matrix viewProjRow = viewRow * projRow;
+    const Vector3 center = mirrorBox.Center;
+    const Vector3 extents = mirrorBox.Extents;
+    Vector4 corners[8];
+    for (int i = 0; i < 8; i++) {
+        const Vector3 p =
+            center + Vector3(i & 1 ? extents.x : -extents.x,
+                             i & 2 ? extents.y : -extents.y,
+                             i & 4 ? extents.z : -extents.z);
+        corners[i] = Vector4::Transform(Vector4(p.x, p.y, p.z, 1.0f),
+                                        viewProjRow);
+    }
+
+    // near 평면(z = 0) 앞의 꼭지점과 모서리 12개가 near 평면과 만나는 점
+    float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+    bool beyondFar = true;
+    auto addPoint = [&](const Vector4 &c) {
+        minX = std::min(minX, c.x / c.w);
+        maxX = std::max(maxX, c.x / c.w);
+        minY = std::min(minY, c.y / c.w);
+        maxY = std::max(maxY, c.y / c.w);
+        beyondFar = beyondFar && c.z > c.w;
+    };
+    for (int i = 0; i < 8; i++) {
+        if (corners[i].z >= 0.0f) {
+            addPoint(corners[i]);
+        }
+        for (int axis = 0; axis < 3; axis++) {
+            const int j = i | (1 << axis);
+            const Vector4 &a = corners[i];
+            const Vector4 &b = corners[j];
+            if (j != i && (a.z < 0.0f) != (b.z < 0.0f)) {
+                addPoint(a + (b - a) * (a.z / (a.z - b.z)));
+            }
+        }
+    }
+
+    if (minX > maxX || beyondFar) {
+        return view; // 모두 카메라 뒤 또는 far 너머
+    }
+    minX = std::max(minX, -1.0f);
+    maxX = std::min(maxX, 1.0f);
+    minY = std::max(minY, -1.0f);
+    maxY = std::min(maxY, 1.0f);
+    if (minX >= maxX || minY >= maxY) {
+        return view; // 화면 밖
+    }
+
+    // 픽셀 단위 Scissor (NDC의 y는 위쪽이 +)
+    view.scissor.left = LONG(std::floor((minX + 1.0f) * 0.5f * screenWidth));
+    view.scissor.right = LONG(std::ceil((maxX + 1.0f) * 0.5f * screenWidth));
+    view.scissor.top = LONG(std::floor((1.0f - maxY) * 0.5f * screenHeight));
+    view.scissor.bottom =
+        LONG(std::ceil((1.0f - minY) * 0.5f * screenHeight));
+    if (view.scissor.left >= view.scissor.right ||
+        view.scissor.top >= view.scissor.bottom) {
+        return view;
+    }
+    view.isVisible = true;
+
+    // 2. 사각형 [minX, maxX] x [minY, maxY]를 [-1, 1]로 늘리는 클립 공간 변환
+    //    x' = (x - cx * w) * sx
+    const float sx = 2.0f / (maxX - minX), cx = (minX + maxX) * 0.5f;
+    const float sy = 2.0f / (maxY - minY), cy = (minY + maxY) * 0.5f;
+    Matrix zoomRow;
+    zoomRow._11 = sx;
+    zoomRow._41 = -sx * cx;
+    zoomRow._22 = sy;
+    zoomRow._42 = -sy * cy;
+
+    const Matrix reflectRow = Matrix::CreateReflection(mirrorPlane);
+    Camera::ExtractFrustumPlanes(reflectRow * viewProjRow * zoomRow,
+                                 view.planes);
+
+    // 반사된 시점의 near 평면 대신 거울 평면 (앞면 쪽이 안쪽)
+    view.planes[4] = Vector4(plane.x, plane.y, plane.z, plane.w);
+
+    return view;
+}
+
+} // namespace Moon
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <DirectXCollision.h>
+#include <d3d11.h>
+#include <directxtk/SimpleMath.h>
+
+namespace Moon {
+
+using DirectX::SimpleMath::Matrix;
+using DirectX::SimpleMath::Plane;
+using DirectX::SimpleMath::Vector3;
+using DirectX::SimpleMath::Vector4;
+
+// 평면 거울에 비친 장면을 그릴 때 필요한 가시성 정보
+struct ReflectionView {
+    bool isVisible = false; // false면 반사 패스 전체를 건너뜀
+
+    // 화면에서 거울이 차지하는 사각형 (스텐실/반사 패스의 Scissor)
+    D3D11_RECT scissor = {0, 0, 0, 0};
+
+    // 반사된 시점의 절두체를 거울 사각형으로 좁힌 평면 6개
+    // near 대신 거울 평면을 사용 (거울 뒤의 물체는 비치지 않음)
+    // 반사하기 전의 월드 공간 바운딩 볼륨을 그대로 FrustumCuller에 넣으면 됨
+    Vector4 planes[6];
+};
+
+// 1. 거울의 AABB를 클립 공간으로 옮기고 near 평면으로 잘라서 화면 사각형 계산
+//    (카메라가 거울 뒤에 있거나 사각형이 화면 밖이면 보이지 않음)
+// 2. 반사 행렬 * view * proj 뒤에 그 사각형을 [-1, 1]로 늘리는 행렬을 곱해서
+//    절두체 평면 추출
+// 참고: Eric Lengyel "Oblique View Frustum Depth Projection and Clipping"
+// https://terathon.com/lengyel/Lengyel-Oblique.pdf
+
+class ReflectionCuller {
+  public:
+    // mirrorBox: 거울의 월드 공간 AABB, mirrorPlane: 노멀이 거울 앞면 방향
+    static ReflectionView Compute(const DirectX::BoundingBox &mirrorBox,
+                                  const Plane &mirrorPlane,
+                                  const Vector3 &eyeWorld,
+                                  const Matrix &viewRow, const Matrix &projRow,
+                                  int screenWidth, int screenHeight);
+};
+
+} // namespace Moon
@@ -0,0 +1,422 @@
+#include "SceneBVH.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <numeric>
+
+namespace Moon {
+
+using namespace std;
+using DirectX::BoundingBox;
+using DirectX::BoundingSphere;
+
+namespace {
+
+// 광선과 상자가 만나는 가장 가까운 거리 (안 만나면 FLT_MAX)
+float IntersectRay(const Vector3 &origin, const Vector3 &invDir,
+                   const Vector3 &min, const Vector3 &max, float maxDistance) {
+    const Vector3 t0 = (min - origin) * invDir;
+    const Vector3 t1 = (max - origin) * invDir;
+    const Vector3 tNear = Vector3::Min(t0, t1);
+    const Vector3 tFar = Vector3::Max(t0, t1);
+    const float enter = std::max({tNear.x, tNear.y, tNear.z, 0.0f});
+    const float exit = std::min({tFar.x, tFar.y, tFar.z, maxDistance});
+    return enter <= exit ? enter : FLT_MAX;
+}
+
+// 0: 평면 밖, 1: 걸침, 2: 안쪽
+int ClassifyBox(const Vector4 &plane, const Vector3 &min, const Vector3 &max) {
+    const Vector3 center = (min + max) * 0.5f;
+    const Vector3 extents = (max - min) * 0.5f;
+    const float distance = plane.x * center.x + plane.y * center.y +
+                           plane.z * center.z + plane.w;
+    const float radius = std::abs(plane.x) * extents.x +
+                         std::abs(plane.y) * extents.y +
+                         std::abs(plane.z) * extents.z;
+    if (distance + radius < 0.0f) {
+        return 0;
+    }
+    return distance - radius >= 0.0f ? 2 : 1;
+}
+
+bool OverlapSphere(const BoundingSphere &sphere, const Vector3 &min,
+                   const Vector3 &max) {
+    const Vector3 center = sphere.Center;
+    const Vector3 closest = Vector3::Max(min, Vector3::Min(center, max));
+    return (closest - center).LengthSquared() <=
+           sphere.Radius * sphere.Radius;
+}
+
+} // namespace
+
+float SceneBVH::Area(const Vector3 &min, const Vector3 &max) {
+    const Vector3 d = Vector3::Max(max - min, Vector3(0.0f));
+    return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+}
+
+void SceneBVH::FitLeaf(Node &node) const {
+    node.min = Vector3(FLT_MAX);
+    node.max = Vector3(-FLT_MAX);
+    for (uint32_t i = node.first; i < node.first + node.count; i++) {
+        node.min = Vector3::Min(node.min, m_objectMin[m_ids[i]]);
+        node.max = Vector3::Max(node.max, m_objectMax[m_ids[i]]);
+    }
+}
+
+void SceneBVH::Build(const vector<BoundingBox> &boxes,
+                     const SceneBVHOptions &options) {
+
+    m_options = options;
+    m_options.maxLeafSize = std::max(m_options.maxLeafSize, 1u);
+
+    const uint32_t numObjects = uint32_t(boxes.size());
+    m_objectMin.resize(numObjects);
+    m_objectMax.resize(numObjects);
+    for (uint32_t i = 0; i < numObjects; i++) {
+        const Vector3 center = boxes[i].Center;
+        const Vector3 extents = boxes[i].Extents;
+        m_objectMin[i] = center - extents;
+        m_objectMax[i] = center + extents;
+    }
+
+    m_ids.resize(numObjects);
+    std::iota(m_ids.begin(), m_ids.end(), 0);
+    m_leafOf.assign(numObjects, 0);
+
+    m_nodes.clear();
+    m_nodes.reserve(size_t(numObjects) * 2 + 1);
+    m_nodes.emplace_back();
+    m_nodes[0].count = numObjects;
+    FitLeaf(m_nodes[0]);
+
+    // 깊이 우선으로 나눔 (자식 두 개는 항상 연속된 인덱스)
+    vector<uint32_t> stack = {0};
+    while (!stack.empty()) {
+        const uint32_t nodeIndex = stack.back();
+        stack.pop_back();
+        Split(nodeIndex);
+        if (m_nodes[nodeIndex].left) {
+            stack.push_back(m_nodes[nodeIndex].left);
+            stack.push_back(m_nodes[nodeIndex].left + 1);
+        }
+    }
+
+    m_area = 0.0f;
+    for (uint32_t n = 0; n < uint32_t(m_nodes.size()); n++) {
+        const Node &node = m_nodes[n];
+        m_area += Area(node.min, node.max);
+        if (!node.left) {
+            for (uint32_t i = node.first; i < node.first + node.count; i++) {
+                m_leafOf[m_ids[i]] = n;
+            }
+        }
+    }
+    m_buildArea = m_area;
+}
+
+void SceneBVH::Split(uint32_t nodeIndex) {
+
+    const Node node = m_nodes[nodeIndex];
+    if (node.count <= m_options.maxLeafSize) {
+        return;
+    }
+
+    // 중심점들의 범위에서 가장 긴 축
+    Vector3 cmin(FLT_MAX), cmax(-FLT_MAX);
+    for (uint32_t i = node.first; i < node.first + node.count; i++) {
+        const Vector3 c = (m_objectMin[m_ids[i]] + m_objectMax[m_ids[i]]);
+        cmin = Vector3::Min(cmin, c);
+        cmax = Vector3::Max(cmax, c);
+    }
+    const Vector3 extent = cmax - cmin;
+    int axis = 0;
+    if (extent.y > extent.x) {
+        axis = 1;
+    }
+    if (extent.z > (&extent.x)[axis]) {
+        axis = 2;
+    }
+    const float lo = (&cmin.x)[axis];
+    const float range = (&extent.x)[axis];
+
+    uint32_t mid = node.first + node.count / 2;
+    auto centerOf = [&](uint32_t id) {
+        return (&m_objectMin[id].x)[axis] + (&m_objectMax[id].x)[axis];
+    };
+
+    if (range > 0.0f) {
+        // 구간마다 개수와 상자를 모은 후 경계마다 SAH 비용 비교
+        const int numBins = std::max(m_options.numBins, 2);
+        struct Bin {
+            Vector3 min = Vector3(FLT_MAX), max = Vector3(-FLT_MAX);
+            uint32_t count = 0;
+        };
+        vector<Bin> bins(numBins);
+        const float scale = numBins / range;
+        auto binOf = [&](uint32_t id) {
+            return std::min(int((centerOf(id) - lo) * scale), numBins - 1);
+        };
+        for (uint32_t i = node.first; i < node.first + node.count; i++) {
+            Bin &bin = bins[binOf(m_ids[i])];
+            bin.min = Vector3::Min(bin.min, m_objectMin[m_ids[i]]);
+            bin.max = Vector3::Max(bin.max, m_objectMax[m_ids[i]]);
+            bin.count++;
+        }
+
+        // 오른쪽부터 누적한 면적과 개수
+        vector<float> rightCost(numBins, 0.0f);
+        Bin right;
+        for (int b = numBins - 1; b > 0; b--) {
+            right.min = Vector3::Min(right.min, bins[b].min);
+            right.max = Vector3::Max(right.max, bins[b].max);
+            right.count += bins[b].count;
+            if (right.count) {
+                rightCost[b] = right.count * Area(right.min, right.max);
+            }
+        }
+
+        float bestCost = FLT_MAX;
+        int bestSplit = -1;
+        Bin left;
+        for (int b = 0; b < numBins - 1; b++) {
+            left.min = Vector3::Min(left.min, bins[b].min);
+            left.max = Vector3::Max(left.max, bins[b].max);
+            left.count += bins[b].count;
+            if (left.count == 0 || left.count == node.count) {
+                continue;
+            }
+            const float cost =
+                left.count * Area(left.min, left.max) + rightCost[b + 1];
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestSplit = b;
+            }
+        }
+
+        if (bestSplit >= 0) {
+            const auto it = std::partition(
+                m_ids.begin() + node.first,
+                m_ids.begin() + node.first + node.count,
+                [&](uint32_t id) { return binOf(id) <= bestSplit; });
+            mid = uint32_t(it - m_ids.begin());
+        }
+    }
+
+    // 중심이 모두 같거나 한쪽으로 쏠리면 반으로 나눔
+    if (mid == node.first || mid == node.first + node.count) {
+        mid = node.first + node.count / 2;
+        std::nth_element(m_ids.begin() + node.first, m_ids.begin() + mid,
+                         m_ids.begin() + node.first + node.count,
+                         [&](uint32_t a, uint32_t b) {
+                             return centerOf(a) < centerOf(b);
+                         });
+    }
+
+    const uint32_t left = uint32_t(m_nodes.size());
+    m_nodes.resize(m_nodes.size() + 2);
+    m_nodes[left].first = node.first;
+    m_nodes[left].count = mid - node.first;
+    m_nodes[left + 1].first = mid;
+    m_nodes[left + 1].count = node.first + node.count - mid;
+    for (uint32_t c = left; c <= left + 1; c++) {
+        m_nodes[c].parent = nodeIndex;
+        FitLeaf(m_nodes[c]);
+    }
+    m_nodes[nodeIndex].left = left;
+}
+
+void SceneBVH::Update(uint32_t id, const BoundingBox &box) {
+
+    if (id >= m_objectMin.size()) {
+        return;
+    }
+    const Vector3 center = box.Center;
+    const Vector3 extents = box.Extents;
+    m_objectMin[id] = center - extents;
+    m_objectMax[id] = center + extents;
+
+    uint32_t nodeIndex = m_leafOf[id];
+    while (true) {
+        Node &node = m_nodes[nodeIndex];
+        const Vector3 oldMin = node.min, oldMax = node.max;
+        if (node.left) {
+            const Node &a = m_nodes[node.left];
+            const Node &b = m_nodes[node.left + 1];
+            node.min = Vector3::Min(a.min, b.min);
+            node.max = Vector3::Max(a.max, b.max);
+        } else {
+            FitLeaf(node);
+        }
+
+        // 상자가 그대로면 조상들도 그대로
+        if (node.min == oldMin && node.max == oldMax) {
+            break;
+        }
+        m_area += Area(node.min, node.max) - Area(oldMin, oldMax);
+
+        if (nodeIndex == 0) {
+            break;
+        }
+        nodeIndex = node.parent;
+    }
+}
+
+bool SceneBVH::NeedsRebuild() const {
+    return m_area > m_buildArea * m_options.rebuildRatio;
+}
+
+bool SceneBVH::RayCast(const Vector3 &origin, const Vector3 &dir, uint32_t &id,
+                       float &distance,
+                       const function<bool(uint32_t, float &)> &intersect)
+    const {
+
+    if (m_nodes.empty() || m_ids.empty()) {
+        return false;
+    }
+
+    // 0으로 나누면 무한대가 되어 슬랩 검사가 그대로 동작
+    const Vector3 invDir(1.0f / dir.x, 1.0f / dir.y, 1.0f / dir.z);
+
+    float best = FLT_MAX;
+    bool hit = false;
+
+    vector<pair<uint32_t, float>> stack;
+    const float rootDistance =
+        IntersectRay(origin, invDir, m_nodes[0].min, m_nodes[0].max, best);
+    if (rootDistance != FLT_MAX) {
+        stack.push_back({0, rootDistance});
+    }
+
+    while (!stack.empty()) {
+        const auto [nodeIndex, nodeDistance] = stack.back();
+        stack.pop_back();
+        if (nodeDistance >= best) {
+            continue;
+        }
+
+        const Node &node = m_nodes[nodeIndex];
+        if (node.left) {
+            // 가까운 자식을 먼저 꺼내도록 나중에 넣음
+            float d[2];
+            for (int c = 0; c < 2; c++) {
+                const Node &child = m_nodes[node.left + c];
+                d[c] = IntersectRay(origin, invDir, child.min, child.max, best);
+            }
+            const int nearChild = d[0] <= d[1] ? 0 : 1;
+            for (int c : {1 - nearChild, nearChild}) {
+                if (d[c] != FLT_MAX) {
+                    stack.push_back({node.left + c, d[c]});
+                }
+            }
+            continue;
+        }
+
+        for (uint32_t i = node.first; i < node.first + node.count; i++) {
+            const uint32_t objectId = m_ids[i];
+            float d = IntersectRay(origin, invDir, m_objectMin[objectId],
+                                   m_objectMax[objectId], best);
+            if (d == FLT_MAX || (intersect && !intersect(objectId, d))) {
+                continue;
+            }
+            if (d < best) {
+                best = d;
+                id = objectId;
+                hit = true;
+            }
+        }
+    }
+
+    if (hit) {
+        distance = best;
+    }
+    return hit;
+}
+
+size_t SceneBVH::QueryFrustum(const Vector4 planes[6],
+                              vector<uint32_t> &ids) const {
+
+    ids.clear();
+    if (m_nodes.empty() || m_ids.empty()) {
+        return 0;
+    }
+
+    // 노드와 아직 검사해야 하는 평면들의 비트마스크
+    vector<pair<uint32_t, uint32_t>> stack = {{0, 0x3f}};
+    while (!stack.empty()) {
+        const auto [nodeIndex, parentMask] = stack.back();
+        stack.pop_back();
+        const Node &node = m_nodes[nodeIndex];
+
+        uint32_t mask = parentMask;
+        bool outside = false;
+        for (int p = 0; p < 6 && !outside; p++) {
+            if (mask & (1 << p)) {
+                const int c = ClassifyBox(planes[p], node.min, node.max);
+                outside = c == 0;
+                if (c == 2) {
+                    mask &= ~(1u << p);
+                }
+            }
+        }
+        if (outside) {
+            continue;
+        }
+
+        if (mask == 0) {
+            // 완전히 안쪽이므로 자손 물체 모두
+            ids.insert(ids.end(), m_ids.begin() + node.first,
+                       m_ids.begin() + node.first + node.count);
+        } else if (node.left) {
+            stack.push_back({node.left, mask});
+            stack.push_back({node.left + 1, mask});
+        } else {
+            for (uint32_t i = node.first; i < node.first + node.count; i++) {
+                const uint32_t objectId = m_ids[i];
+                bool visible = true;
+                for (int p = 0; p < 6 && visible; p++) {
+                    visible = !(mask & (1 << p)) ||
+                              ClassifyBox(planes[p], m_objectMin[objectId],
+                                          m_objectMax[objectId]) != 0;
+                }
+                if (visible) {
+                    ids.push_back(objectId);
+                }
+            }
+        }
+    }
+
+    return ids.size();
+}
+
+size_t SceneBVH::QuerySphere(const BoundingSphere &sphere,
+                             vector<uint32_t> &ids) const {
+
+    ids.clear();
+    if (m_nodes.empty() || m_ids.empty()) {
+        return 0;
+    }
+
+    vector<uint32_t> stack = {0};
+    while (!stack.empty()) {
+        const Node &node = m_nodes[stack.back()];
+        stack.pop_back();
+        if (!OverlapSphere(sphere, node.min, node.max)) {
+            continue;
+        }
+        if (node.left) {
+            stack.push_back(node.left);
+            stack.push_back(node.left + 1);
+            continue;
+        }
+        for (uint32_t i = node.first; i < node.first + node.count; i++) {
+            if (OverlapSphere(sphere, m_objectMin[m_ids[i]],
+                              m_objectMax[m_ids[i]])) {
+                ids.push_back(m_ids[i]);
+            }
+        }
+    }
+
+    return ids.size();
+}
+
+} // namespace Moon
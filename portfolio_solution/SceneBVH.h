@@ -0,0 +1,85 @@
+#pragma once
+
+#include <DirectXCollision.h>
+#include <directxtk/SimpleMath.h>
+#include <functional>
+#include <vector>
+
+namespace Moon {
+
+using DirectX::SimpleMath::Vector3;
+using DirectX::SimpleMath::Vector4;
+
+struct SceneBVHOptions {
+    uint32_t maxLeafSize = 4;
+    int numBins = 12; // SAH를 계산할 구간 개수
+    // 움직인 물체로 넓어진 노드들의 표면적 합이 만들 때보다
+    // 이 배수를 넘으면 NeedsRebuild()가 true
+    float rebuildRatio = 1.5f;
+};
+
+// 장면 전체 물체들의 월드 공간 AABB로 만든 BVH
+// 물체는 0부터 시작하는 id (예: m_basicList의 인덱스)로 구분
+// 1. Build(): 중심점 기준 binned SAH로 분할, 한 노드의 물체들은 m_ids에서 연속
+// 2. Update(): 물체 하나의 상자를 바꾸고 부모 방향으로 상자를 다시 맞춤 (refit)
+//    트리 구조는 그대로이므로 많이 움직이면 NeedsRebuild()를 보고 다시 만듦
+// 3. 광선/절두체/구 질의는 겹치는 노드만 내려감
+// 참고: Ingo Wald "On fast Construction of SAH-based Bounding Volume
+// Hierarchies" (2007)
+// 참고: Jacco Bikker "How to build a BVH"
+// https://jacco.ompf2.com/2022/04/13/how-to-build-a-bvh-part-1-basics/
+
+class SceneBVH {
+  public:
+    void Build(const std::vector<DirectX::BoundingBox> &boxes,
+               const SceneBVHOptions &options = SceneBVHOptions());
+
+    // 물체 id의 상자를 바꾸고 조상 노드들의 상자를 갱신 (O(깊이))
+    void Update(uint32_t id, const DirectX::BoundingBox &box);
+
+    bool NeedsRebuild() const;
+
+    size_t Size() const { return m_objectMin.size(); }
+
+    // 가장 가까운 물체 (dir은 정규화)
+    // intersect가 있으면 상자와 만나는 물체마다 호출해서 정밀하게 판정
+    // (false면 제외, distance를 더 정확한 값으로 바꿀 수 있음)
+    bool RayCast(const Vector3 &origin, const Vector3 &dir, uint32_t &id,
+                 float &distance,
+                 const std::function<bool(uint32_t id, float &distance)>
+                     &intersect = nullptr) const;
+
+    // 절두체 안에 있거나 걸친 물체들 (planes: Camera::ExtractFrustumPlanes())
+    // 평면 안쪽에 완전히 들어간 노드는 더 검사하지 않고 물체들을 모두 추가
+    size_t QueryFrustum(const Vector4 planes[6],
+                        std::vector<uint32_t> &ids) const;
+
+    size_t QuerySphere(const DirectX::BoundingSphere &sphere,
+                       std::vector<uint32_t> &ids) const;
+
+  private:
+    struct Node {
+        Vector3 min;
+        Vector3 max;
+        uint32_t first = 0; // m_ids 안의 범위 (내부 노드도 자손 전체)
+        uint32_t count = 0;
+        uint32_t left = 0;  // 왼쪽 자식 (오른쪽은 left + 1), 0이면 리프
+        uint32_t parent = 0;
+    };
+
+    void Split(uint32_t nodeIndex);
+    void FitLeaf(Node &node) const;
+    static float Area(const Vector3 &min, const Vector3 &max);
+
+    SceneBVHOptions m_options;
+    std::vector<Node> m_nodes;
+    std::vector<uint32_t> m_ids;      // 노드 범위 순서로 정렬된 물체 id
+    std::vector<uint32_t> m_leafOf;   // 물체 id -> 리프 노드
+    std::vector<Vector3> m_objectMin; // 물체 id별 상자
+    std::vector<Vector3> m_objectMax;
+
+    float m_buildArea = 0.0f; // Build() 직후 모든 노드의 표면적 합
+    float m_area = 0.0f;      // Update()로 바뀐 현재 값
+};
+
+} // namespace Moon
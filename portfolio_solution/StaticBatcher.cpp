@@ -0,0 +1,198 @@
+#include "StaticBatcher.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <iostream>
+#include <unordered_map>
+
+namespace Moon {
+
+using namespace std;
+using DirectX::SimpleMath::Vector3;
+
+namespace {
+
+// 10비트 정수의 비트 사이에 0을 두 개씩 끼워 넣음
+uint32_t SpreadBits(uint32_t x) {
+    x &= 0x3ff;
+    x = (x | (x << 16)) & 0x030000ff;
+    x = (x | (x << 8)) & 0x0300f00f;
+    x = (x | (x << 4)) & 0x030c30c3;
+    x = (x | (x << 2)) & 0x09249249;
+    return x;
+}
+
+// [vmin, vmax] 안의 점을 30비트 Morton 코드로
+uint32_t MortonCode(const Vector3 &p, const Vector3 &vmin,
+                    const Vector3 &vmax) {
+    const Vector3 extent = Vector3::Max(vmax - vmin, Vector3(1e-6f));
+    const Vector3 t = Vector3::Max(
+        Vector3(0.0f), Vector3::Min((p - vmin) / extent, Vector3(1.0f)));
+    return (SpreadBits(uint32_t(t.x * 1023.0f)) << 2) |
+           (SpreadBits(uint32_t(t.y * 1023.0f)) << 1) |
+           SpreadBits(uint32_t(t.z * 1023.0f));
+}
+
+float LongestEdge(const DirectX::BoundingBox &box) {
+    return 2.0f * std::max({box.Extents.x, box.Extents.y, box.Extents.z});
+}
+
+// batch의 메쉬들을 하나로 합침 (첫 메쉬의 텍스춰 사용)
+MeshData Merge(vector<MeshData> &meshes, const vector<size_t> &batch) {
+
+    if (batch.size() == 1) {
+        return std::move(meshes[batch[0]]);
+    }
+
+    MeshData merged;
+    const MeshData &first = meshes[batch[0]];
+    merged.albedoTextureFilename = first.albedoTextureFilename;
+    merged.emissiveTextureFilename = first.emissiveTextureFilename;
+    merged.normalTextureFilename = first.normalTextureFilename;
+    merged.heightTextureFilename = first.heightTextureFilename;
+    merged.aoTextureFilename = first.aoTextureFilename;
+    merged.metallicTextureFilename = first.metallicTextureFilename;
+    merged.roughnessTextureFilename = first.roughnessTextureFilename;
+
+    size_t numVertices = 0, numIndices = 0;
+    bool mergeLods = true;
+    for (const size_t i : batch) {
+        numVertices += meshes[i].vertices.size();
+        numIndices += meshes[i].indices.size();
+        mergeLods = mergeLods && meshes[i].lodIndices.size() ==
+                                     first.lodIndices.size();
+    }
+    merged.vertices.reserve(numVertices);
+    merged.indices.reserve(numIndices);
+    if (mergeLods) {
+        merged.lodIndices.resize(first.lodIndices.size());
+    }
+
+    for (const size_t i : batch) {
+        MeshData &mesh = meshes[i];
+        const uint32_t base = uint32_t(merged.vertices.size());
+
+        merged.vertices.insert(merged.vertices.end(), mesh.vertices.begin(),
+                               mesh.vertices.end());
+        for (const uint32_t index : mesh.indices) {
+            merged.indices.push_back(index + base);
+        }
+        for (size_t l = 0; l < merged.lodIndices.size(); l++) {
+            for (const uint32_t index : mesh.lodIndices[l]) {
+                merged.lodIndices[l].push_back(index + base);
+            }
+        }
+
+        mesh = MeshData(); // 메모리를 바로 반환
+    }
+
+    merged.bounds = BoundsBuilder::Compute(merged.vertices);
+
+    return merged;
+}
+
+} // namespace
+
+string StaticBatcher::MaterialKey(const MeshData &meshData) {
+    // 파일 이름에 나올 수 없는 문자로 구분
+    string key;
+    for (const auto *name :
+         {&meshData.albedoTextureFilename, &meshData.emissiveTextureFilename,
+          &meshData.normalTextureFilename, &meshData.heightTextureFilename,
+          &meshData.aoTextureFilename, &meshData.metallicTextureFilename,
+          &meshData.roughnessTextureFilename}) {
+        key += *name;
+        key += '|';
+    }
+    return key;
+}
+
+void StaticBatcher::Batch(vector<MeshData> &meshes,
+                          const BatchOptions &options) {
+
+    if (meshes.size() <= 1) {
+        return;
+    }
+
+    // 바운딩 볼륨이 없는 메쉬는 AABB만 계산 (정렬과 크기 제한에 사용)
+    Vector3 vmin(FLT_MAX), vmax(-FLT_MAX);
+    for (auto &mesh : meshes) {
+        if (!mesh.bounds.isValid) {
+            mesh.bounds = BoundsBuilder::Compute(mesh.vertices, false);
+        }
+        if (mesh.bounds.isValid) {
+            const Vector3 center = mesh.bounds.aabb.Center;
+            const Vector3 extents = mesh.bounds.aabb.Extents;
+            vmin = Vector3::Min(vmin, center - extents);
+            vmax = Vector3::Max(vmax, center + extents);
+        }
+    }
+
+    // 1. 재질 키로 묶음
+    vector<vector<size_t>> groups;
+    unordered_map<string, size_t> groupOfKey;
+    for (size_t i = 0; i < meshes.size(); i++) {
+        const auto result =
+            groupOfKey.emplace(MaterialKey(meshes[i]), groups.size());
+        if (result.second) {
+            groups.emplace_back();
+        }
+        groups[result.first->second].push_back(i);
+    }
+
+    vector<MeshData> batched;
+    for (auto &group : groups) {
+
+        // 2. 공간적으로 가까운 메쉬가 이웃하도록 정렬
+        vector<pair<uint32_t, size_t>> order(group.size());
+        for (size_t i = 0; i < group.size(); i++) {
+            order[i] = {MortonCode(meshes[group[i]].bounds.aabb.Center, vmin,
+                                   vmax),
+                        group[i]};
+        }
+        std::sort(order.begin(), order.end());
+
+        // 3. 제한을 넘기 전까지 이어서 모음 (혼자서 넘는 메쉬는 그대로)
+        vector<size_t> batch;
+        size_t numVertices = 0, numIndices = 0;
+        DirectX::BoundingBox box;
+        for (const auto &item : order) {
+            const MeshData &mesh = meshes[item.second];
+
+            if (!batch.empty()) {
+                DirectX::BoundingBox mergedBox;
+                DirectX::BoundingBox::CreateMerged(mergedBox, box,
+                                                   mesh.bounds.aabb);
+                if (numVertices + mesh.vertices.size() > options.maxVertices ||
+                    numIndices + mesh.indices.size() > options.maxIndices ||
+                    LongestEdge(mergedBox) > options.maxExtent) {
+                    batched.push_back(Merge(meshes, batch));
+                    batch.clear();
+                    numVertices = numIndices = 0;
+                } else {
+                    box = mergedBox;
+                }
+            }
+            if (batch.empty()) {
+                box = mesh.bounds.aabb;
+            }
+
+            batch.push_back(item.second);
+            numVertices += mesh.vertices.size();
+            numIndices += mesh.indices.size();
+        }
+        if (!batch.empty()) {
+            batched.push_back(Merge(meshes, batch));
+        }
+    }
+
+    if (options.printStats) {
+        cout << "Static batching: " << meshes.size() << " meshes -> "
+             << batched.size() << " (" << groups.size() << " materials)"
+             << endl;
+    }
+
+    meshes = std::move(batched);
+}
+
+} // namespace Moon
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+
+#include "MeshData.h"
+
+namespace Moon {
+
+// 재질이 같은 메쉬들을 임포트할 때 하나로 합쳐서 드로우 콜과 상태 변경을 줄임
+// CAD/FBX 에셋처럼 작은 서브메쉬가 수천 개인 모델에 효과가 큼
+// 1. 텍스춰 파일 이름들(재질 키)로 묶음
+// 2. 묶음 안에서 바운딩 볼륨 중심의 Morton 순서로 정렬해서 가까운 것끼리 모음
+// 3. 버텍스/인덱스 개수와 AABB 크기 제한 안에서 버텍스를 이어 붙이고
+//    인덱스는 앞쪽 버텍스 개수만큼 더함
+// 합친 메쉬가 너무 커지면 컬링(Meshlet, 절두체)의 효과가 줄어들므로 크기 제한
+// 참고: Unity "Static batching"
+// https://docs.unity3d.com/Manual/static-batching.html
+
+struct BatchOptions {
+    size_t maxVertices = 1 << 16;
+    size_t maxIndices = 3 << 16;
+    // 합친 AABB의 가장 긴 변 (ReadFromFile()은 모델 전체를 1로 정규화)
+    float maxExtent = 0.5f;
+    bool printStats = false;
+};
+
+class StaticBatcher {
+  public:
+    // 재질을 구분하는 키 (Model은 재질 상수를 모든 메쉬가 공유하므로 텍스춰만)
+    static std::string MaterialKey(const MeshData &meshData);
+
+    // meshes를 합친 결과로 바꿈 (재질 키가 처음 나온 순서 유지)
+    // lodIndices는 모든 메쉬의 LOD 개수가 같을 때만 이어 붙이고 아니면 버림
+    static void Batch(std::vector<MeshData> &meshes,
+                      const BatchOptions &options = BatchOptions());
+};
+
+} // namespace Moon
@@ -0,0 +1,174 @@
+#include "TangentGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+#include "ThreadPool.h"
+#include "Vec3x4.h"
+
+namespace Moon {
+
+using namespace std;
+using namespace DirectX;
+using DirectX::SimpleMath::Vector3;
+
+namespace {
+
+// indices부터 삼각형 4개의 corner번째 버텍스의 멤버를 모음
+// (남는 자리는 마지막 삼각형을 반복)
+template <typename T>
+inline void Gather(const vector<Vertex> &vertices, const uint32_t *indices,
+                   size_t count, int corner, T Vertex::*member, T out[4]) {
+    for (size_t k = 0; k < 4; k++) {
+        const size_t t = min(k, count - 1);
+        out[k] = vertices[indices[t * 3 + corner]].*member;
+    }
+}
+
+// triangleCount(1~4)개 삼각형의 코너별 가중 탄젠트를 corners에 저장
+void ComputeCorners(const vector<Vertex> &vertices, const uint32_t *indices,
+                    size_t triangleCount, Vector3 *corners) {
+
+    Vec3x4 p[3], n[3];
+    XMVECTOR u[3], v[3];
+    for (int c = 0; c < 3; c++) {
+        Vector3 temp[4];
+        Gather(vertices, indices, triangleCount, c, &Vertex::position, temp);
+        p[c] = Load3x4(temp);
+        Gather(vertices, indices, triangleCount, c, &Vertex::normalModel,
+               temp);
+        n[c] = Load3x4(temp);
+
+        Vector2 uv[4];
+        Gather(vertices, indices, triangleCount, c, &Vertex::texcoord, uv);
+        u[c] = XMVectorSet(uv[0].x, uv[1].x, uv[2].x, uv[3].x);
+        v[c] = XMVectorSet(uv[0].y, uv[1].y, uv[2].y, uv[3].y);
+    }
+
+    // 삼각형의 탄젠트 (UV 크기와 무관하도록 정규화)
+    // T = (e1 * dv2 - e2 * dv1) / det, 부호만 det를 따름
+    const Vec3x4 e1 = Sub(p[1], p[0]);
+    const Vec3x4 e2 = Sub(p[2], p[0]);
+    const XMVECTOR du1 = XMVectorSubtract(u[1], u[0]);
+    const XMVECTOR dv1 = XMVectorSubtract(v[1], v[0]);
+    const XMVECTOR du2 = XMVectorSubtract(u[2], u[0]);
+    const XMVECTOR dv2 = XMVectorSubtract(v[2], v[0]);
+    const XMVECTOR det = XMVectorSubtract(XMVectorMultiply(du1, dv2),
+                                          XMVectorMultiply(du2, dv1));
+    const XMVECTOR sign =
+        XMVectorSelect(XMVectorReplicate(1.0f), XMVectorReplicate(-1.0f),
+                       XMVectorLess(det, XMVectorZero()));
+    const Vec3x4 triTangent =
+        Normalize(Scale(Sub(Scale(e1, dv2), Scale(e2, dv1)), sign));
+
+    for (int c = 0; c < 3; c++) {
+        const Vec3x4 &normal = n[c];
+
+        // 노멀에 수직인 성분만 사용
+        const Vec3x4 t =
+            Normalize(Sub(triTangent, Scale(normal, Dot(normal, triTangent))));
+
+        // 코너의 각도 (두 변도 노멀에 수직인 평면에 투영)
+        Vec3x4 a = Sub(p[(c + 1) % 3], p[c]);
+        Vec3x4 b = Sub(p[(c + 2) % 3], p[c]);
+        a = Normalize(Sub(a, Scale(normal, Dot(normal, a))));
+        b = Normalize(Sub(b, Scale(normal, Dot(normal, b))));
+        const Vec3x4 weighted = Scale(t, AngleBetweenNormals(a, b));
+
+        Store3x4(weighted, corners + c, triangleCount, 3);
+    }
+}
+
+// 노멀에 수직인 임의의 단위 벡터 (탄젠트를 구할 수 없을 때)
+Vector3 AnyPerpendicular(const Vector3 &normal) {
+    Vector3 t = fabs(normal.x) < 0.9f ? Vector3(1.0f, 0.0f, 0.0f)
+                                      : Vector3(0.0f, 1.0f, 0.0f);
+    t -= normal * normal.Dot(t);
+    t.Normalize();
+    return t;
+}
+
+} // namespace
+
+void TangentGenerator::Generate(vector<Vertex> &vertices,
+                                const vector<uint32_t> &indices,
+                                const TangentOptions &options) {
+
+    const size_t numTriangles = indices.size() / 3;
+    if (vertices.empty()) {
+        return;
+    }
+
+    auto parallelFor = [&](size_t count, const function<void(size_t)> &func) {
+        if (options.parallel && count > 1) {
+            ThreadPool::Get().ParallelFor(count, func);
+        } else {
+            for (size_t i = 0; i < count; i++) {
+                func(i);
+            }
+        }
+    };
+
+    // 1. 코너별 탄젠트
+    vector<Vector3> corners(numTriangles * 3);
+    const size_t trianglesPerTask =
+        max(size_t(4), options.trianglesPerTask / 4 * 4);
+    const size_t numTriangleTasks =
+        (numTriangles + trianglesPerTask - 1) / trianglesPerTask;
+    parallelFor(numTriangleTasks, [&](size_t task) {
+        const size_t begin = task * trianglesPerTask;
+        const size_t end = min(numTriangles, begin + trianglesPerTask);
+        for (size_t t = begin; t < end; t += 4) {
+            ComputeCorners(vertices, &indices[t * 3], min(size_t(4), end - t),
+                           &corners[t * 3]);
+        }
+    });
+
+    // 2. 버텍스 -> 코너 목록 (CSR, 코너 순서대로)
+    vector<uint32_t> offsets(vertices.size() + 1, 0);
+    for (size_t i = 0; i < numTriangles * 3; i++) {
+        offsets[indices[i] + 1]++;
+    }
+    for (size_t v = 0; v < vertices.size(); v++) {
+        offsets[v + 1] += offsets[v];
+    }
+    vector<uint32_t> vertexCorners(numTriangles * 3);
+    {
+        vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < numTriangles * 3; i++) {
+            vertexCorners[fill[indices[i]]++] = uint32_t(i);
+        }
+    }
+
+    // 3. 버텍스마다 합산 후 노멀에 대해 Gram-Schmidt
+    const size_t verticesPerTask = max(size_t(1), options.verticesPerTask);
+    const size_t numVertexTasks =
+        (vertices.size() + verticesPerTask - 1) / verticesPerTask;
+    parallelFor(numVertexTasks, [&](size_t task) {
+        const size_t begin = task * verticesPerTask;
+        const size_t end = min(vertices.size(), begin + verticesPerTask);
+        for (size_t v = begin; v < end; v++) {
+            Vector3 sum(0.0f);
+            for (uint32_t c = offsets[v]; c < offsets[v + 1]; c++) {
+                sum += corners[vertexCorners[c]];
+            }
+
+            const Vector3 &normal = vertices[v].normalModel;
+            sum -= normal * normal.Dot(sum);
+            if (sum.LengthSquared() > 1e-12f) {
+                sum.Normalize();
+                vertices[v].tangentModel = sum;
+            } else {
+                vertices[v].tangentModel = AnyPerpendicular(normal);
+            }
+        }
+    });
+}
+
+void TangentGenerator::Generate(MeshData &meshData,
+                                const TangentOptions &options) {
+    Generate(meshData.vertices, meshData.indices, options);
+}
+
+} // namespace Moon
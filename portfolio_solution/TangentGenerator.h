@@ -0,0 +1,35 @@
+#pragma once
+
+#include "MeshData.h"
+
+namespace Moon {
+
+// Vertex 배열을 직접 읽어서 탄젠트 계산 (DirectXMesh의 ComputeTangentFrame
+// 대신 사용, 임시 배열로 복사하지 않음)
+// MikkTSpace와 같은 방식으로 삼각형의 탄젠트를 버텍스 노멀에 수직이 되도록
+// 투영한 후 코너의 각도를 가중치로 평균
+// 참고: MikkTSpace
+// http://www.mikktspace.com/
+// https://github.com/mmikk/MikkTSpace/blob/master/mikktspace.c
+
+// 1. 삼각형 4개씩 SoA로 묶어서 SIMD로 코너별 탄젠트 계산 (병렬)
+// 2. 버텍스마다 자신을 사용하는 코너들을 인덱스 순서대로 더함 (병렬)
+//    더하는 순서가 스레드 개수와 무관하므로 결과가 항상 같음
+
+struct TangentOptions {
+    bool parallel = true;
+    size_t trianglesPerTask = 16384; // 4의 배수
+    size_t verticesPerTask = 16384;
+};
+
+class TangentGenerator {
+  public:
+    static void Generate(std::vector<Vertex> &vertices,
+                         const std::vector<uint32_t> &indices,
+                         const TangentOptions &options = TangentOptions());
+
+    static void Generate(MeshData &meshData,
+                         const TangentOptions &options = TangentOptions());
+};
+
+} // namespace Moon
@@ -0,0 +1,363 @@
+#include "Terrain.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <fp16.h>
+#include <iostream>
+
+#include "D3D11Utils.h"
+#include "ThreadPool.h"
+
+namespace Moon {
+
+using namespace std;
+
+bool HeightMap::Load(const string &filename, float worldSize,
+                     float heightScale) {
+
+    TextureImage image;
+    D3D11Utils::DecodeTexture(filename, false, image);
+    if (image.width <= 0 || image.height <= 0 || image.image.empty()) {
+        cout << "HeightMap::Load() failed: " << filename << endl;
+        return false;
+    }
+
+    m_width = image.width;
+    m_height = image.height;
+    m_worldSize = worldSize;
+    m_heightScale = heightScale;
+
+    // R 채널만 사용 (EXR은 half float 4채널, 나머지는 8비트 4채널)
+    m_heights.resize(size_t(m_width) * m_height);
+    const bool isHalf = image.pixelFormat == DXGI_FORMAT_R16G16B16A16_FLOAT;
+    const uint16_t *halfs = (const uint16_t *)image.image.data();
+    for (size_t i = 0; i < m_heights.size(); i++) {
+        m_heights[i] = isHalf ? fp16_ieee_to_fp32_value(halfs[i * 4])
+                              : image.image[i * 4] / 255.0f;
+    }
+
+    return true;
+}
+
+float HeightMap::Sample(float x, float z) const {
+
+    if (m_heights.empty()) {
+        return 0.0f;
+    }
+
+    // 텍스춰 좌표와 같은 방향 (z가 커질수록 위쪽 행)
+    const float u = clamp(x / m_worldSize + 0.5f, 0.0f, 1.0f) * (m_width - 1);
+    const float v = clamp(0.5f - z / m_worldSize, 0.0f, 1.0f) * (m_height - 1);
+
+    const int x0 = min(int(u), m_width - 1);
+    const int y0 = min(int(v), m_height - 1);
+    const int x1 = min(x0 + 1, m_width - 1);
+    const int y1 = min(y0 + 1, m_height - 1);
+    const float fx = u - x0;
+    const float fy = v - y0;
+
+    auto At = [&](int i, int j) { return m_heights[size_t(j) * m_width + i]; };
+    const float top = At(x0, y0) * (1.0f - fx) + At(x1, y0) * fx;
+    const float bottom = At(x0, y1) * (1.0f - fx) + At(x1, y1) * fx;
+
+    return (top * (1.0f - fy) + bottom * fy) * m_heightScale;
+}
+
+void Terrain::Initialize(ComPtr<ID3D11Device> &device,
+                         ComPtr<ID3D11DeviceContext> &context,
+                         const HeightFunction &heightFunction,
+                         const TerrainOptions &options) {
+
+    m_heightFunction = heightFunction;
+    m_options = options;
+
+    // 이음매를 만들려면 가장 거친 LOD보다 한 단계 더 나눌 수 있어야 함
+    int &resolution = m_options.chunkResolution;
+    resolution = max(resolution, 2);
+    int maxLods = 0;
+    while ((resolution % (2 << maxLods)) == 0) {
+        maxLods++;
+    }
+    m_options.numLods = clamp(m_options.numLods, 1, max(maxLods, 1));
+    m_options.evictRadius = max(m_options.evictRadius, m_options.loadRadius);
+
+    // 재질과 상수 버퍼는 청크 전체가 공유
+    m_model = make_shared<Model>(device, context, vector<MeshData>());
+
+    vector<uint32_t> indices;
+    vector<uint32_t> allIndices;
+    m_indexRanges.clear();
+    for (int lod = 0; lod < m_options.numLods; lod++) {
+        for (int mask = 0; mask < 16; mask++) {
+            BuildIndices(resolution, lod, mask, indices);
+            m_indexRanges.push_back(make_shared<const vector<MeshLod>>(
+                1, MeshLod{UINT(indices.size()), UINT(allIndices.size())}));
+            allIndices.insert(allIndices.end(), indices.begin(),
+                              indices.end());
+        }
+    }
+    D3D11Utils::CreateIndexBuffer(device, allIndices, m_indexBuffer);
+
+    m_chunks.clear();
+    m_stats = Stats();
+}
+
+void Terrain::BuildIndices(int resolution, int lod, int stitchMask,
+                           vector<uint32_t> &indices) {
+
+    indices.clear();
+
+    const int n = resolution;
+    const int step = 1 << lod;
+    const int coarse = step * 2;
+
+    // 거친 이웃과 닿는 변 위의 버텍스 중 이웃에 없는 것은 변을 따라
+    // 앞쪽 버텍스로 옮김 (경계에서의 half-edge collapse)
+    auto Index = [&](int i, int j) {
+        if ((i == 0 && (stitchMask & EDGE_NEG_X)) ||
+            (i == n && (stitchMask & EDGE_POS_X))) {
+            j -= j % coarse;
+        }
+        if ((j == 0 && (stitchMask & EDGE_NEG_Z)) ||
+            (j == n && (stitchMask & EDGE_POS_Z))) {
+            i -= i % coarse;
+        }
+        return uint32_t(j * (n + 1) + i);
+    };
+
+    auto AddTriangle = [&](uint32_t i0, uint32_t i1, uint32_t i2) {
+        if (i0 != i1 && i1 != i2 && i2 != i0) { // 붙여서 없어진 삼각형 제외
+            indices.insert(indices.end(), {i0, i1, i2});
+        }
+    };
+
+    for (int j = 0; j < n; j += step) {
+        for (int i = 0; i < n; i += step) {
+            const uint32_t i00 = Index(i, j);
+            const uint32_t i10 = Index(i + step, j);
+            const uint32_t i01 = Index(i, j + step);
+            const uint32_t i11 = Index(i + step, j + step);
+
+            // (+x, +z) 모서리에서 두 변을 모두 붙이면 i01-i10 대각선이
+            // i00을 지나가므로 반대쪽 대각선 사용
+            const bool flip = i + step == n && j + step == n &&
+                              (stitchMask & EDGE_POS_X) &&
+                              (stitchMask & EDGE_POS_Z);
+
+            // 위(+y)에서 보았을 때 시계 방향
+            if (flip) {
+                AddTriangle(i00, i01, i11);
+                AddTriangle(i00, i11, i10);
+            } else {
+                AddTriangle(i00, i01, i10);
+                AddTriangle(i10, i01, i11);
+            }
+        }
+    }
+}
+
+uint64_t Terrain::ChunkKey(int x, int z) {
+    return (uint64_t(uint32_t(x)) << 32) | uint64_t(uint32_t(z));
+}
+
+void Terrain::BuildChunkVertices(int x, int z, vector<Vertex> &vertices,
+                                 float &minY, float &maxY) const {
+
+    const int n = m_options.chunkResolution;
+    const float spacing = m_options.chunkSize / n;
+    const float originX = x * m_options.chunkSize;
+    const float originZ = z * m_options.chunkSize;
+
+    // 노멀 계산을 위해 한 칸씩 더 넓게 샘플링 (이웃 청크와 같은 노멀)
+    const int w = n + 3;
+    vector<float> heights(size_t(w) * w);
+    for (int j = 0; j < w; j++) {
+        for (int i = 0; i < w; i++) {
+            heights[size_t(j) * w + i] =
+                m_heightFunction(originX + (i - 1) * spacing,
+                                 originZ + (j - 1) * spacing);
+        }
+    }
+    auto H = [&](int i, int j) { return heights[size_t(j + 1) * w + i + 1]; };
+
+    minY = FLT_MAX;
+    maxY = -FLT_MAX;
+    vertices.resize(size_t(n + 1) * (n + 1));
+    for (int j = 0; j <= n; j++) {
+        for (int i = 0; i <= n; i++) {
+            const float dhdx = (H(i + 1, j) - H(i - 1, j)) / (2.0f * spacing);
+            const float dhdz = (H(i, j + 1) - H(i, j - 1)) / (2.0f * spacing);
+
+            Vertex &v = vertices[size_t(j) * (n + 1) + i];
+            v.position = Vector3(originX + i * spacing, H(i, j),
+                                 originZ + j * spacing);
+            v.normalModel = Vector3(-dhdx, 1.0f, -dhdz);
+            v.normalModel.Normalize();
+            v.tangentModel = Vector3(1.0f, dhdx, 0.0f); // u는 +x 방향
+            v.tangentModel.Normalize();
+            v.texcoord = Vector2(v.position.x, -v.position.z) *
+                         m_options.texScale;
+
+            minY = min(minY, v.position.y);
+            maxY = max(maxY, v.position.y);
+        }
+    }
+}
+
+float Terrain::DistanceToChunk(const Chunk &chunk,
+                               const Vector3 &eyeWorld) const {
+
+    // 청크 AABB에서 가장 가까운 점까지의 거리
+    const float size = m_options.chunkSize;
+    const Vector3 boxMin(chunk.x * size, chunk.minY, chunk.z * size);
+    const Vector3 boxMax =
+        boxMin + Vector3(size, chunk.maxY - chunk.minY, size);
+    const Vector3 closest =
+        Vector3::Max(boxMin, Vector3::Min(eyeWorld, boxMax));
+    return (eyeWorld - closest).Length();
+}
+
+void Terrain::Update(ComPtr<ID3D11Device> &device, const Vector3 &eyeWorld) {
+
+    if (!m_model) {
+        return;
+    }
+
+    const float size = m_options.chunkSize;
+    const int n = m_options.chunkResolution;
+
+    // xz 평면에서 청크 중심까지의 거리
+    auto PlanarDistance = [&](int x, int z) {
+        const float dx = (x + 0.5f) * size - eyeWorld.x;
+        const float dz = (z + 0.5f) * size - eyeWorld.z;
+        return sqrtf(dx * dx + dz * dz);
+    };
+
+    // 1. 멀어진 청크 해제
+    for (auto it = m_chunks.begin(); it != m_chunks.end();) {
+        if (PlanarDistance(it->second.x, it->second.z) >
+            m_options.evictRadius) {
+            it = m_chunks.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // 2. 반경 안의 없는 청크들을 가까운 순서로 몇 개만 생성
+    const int cx = int(floor(eyeWorld.x / size));
+    const int cz = int(floor(eyeWorld.z / size));
+    const int range = int(ceil(m_options.loadRadius / size));
+
+    vector<pair<float, Chunk>> missing;
+    for (int z = cz - range; z <= cz + range; z++) {
+        for (int x = cx - range; x <= cx + range; x++) {
+            const float d = PlanarDistance(x, z);
+            if (d <= m_options.loadRadius &&
+                m_chunks.find(ChunkKey(x, z)) == m_chunks.end()) {
+                Chunk chunk;
+                chunk.x = x;
+                chunk.z = z;
+                missing.push_back({d, chunk});
+            }
+        }
+    }
+    const size_t numBuilds =
+        min(missing.size(), size_t(max(m_options.maxBuildsPerUpdate, 1)));
+    partial_sort(
+        missing.begin(), missing.begin() + numBuilds, missing.end(),
+        [](const auto &a, const auto &b) { return a.first < b.first; });
+
+    vector<vector<Vertex>> vertices(numBuilds);
+    ThreadPool::Get().ParallelFor(numBuilds, [&](size_t k) {
+        Chunk &chunk = missing[k].second;
+        BuildChunkVertices(chunk.x, chunk.z, vertices[k], chunk.minY,
+                           chunk.maxY);
+    });
+
+    // 버퍼 생성은 메인 스레드에서
+    for (size_t k = 0; k < numBuilds; k++) {
+        Chunk &chunk = missing[k].second;
+        chunk.mesh = make_shared<Mesh>();
+        D3D11Utils::CreateVertexBuffer(device, vertices[k],
+                                       chunk.mesh->vertexBuffer);
+        chunk.mesh->indexBuffer = m_indexBuffer;
+        chunk.mesh->vertexCount = UINT(vertices[k].size());
+        chunk.mesh->stride = UINT(sizeof(Vertex));
+        m_chunks[ChunkKey(chunk.x, chunk.z)] = chunk;
+    }
+
+    // 3. 거리로 LOD 선택 후 이웃과 최대 한 단계 차이가 나도록 낮춤
+    for (auto &it : m_chunks) {
+        Chunk &chunk = it.second;
+        const float d = DistanceToChunk(chunk, eyeWorld);
+        chunk.lod = d < m_options.lodDistance
+                        ? 0
+                        : int(log2f(d / m_options.lodDistance)) + 1;
+        chunk.lod = min(chunk.lod, m_options.numLods - 1);
+    }
+
+    auto Neighbor = [&](const Chunk &chunk, int dx, int dz) -> Chunk * {
+        auto found = m_chunks.find(ChunkKey(chunk.x + dx, chunk.z + dz));
+        return found == m_chunks.end() ? nullptr : &found->second;
+    };
+    const int offsets[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (auto &it : m_chunks) {
+            Chunk &chunk = it.second;
+            for (const auto &o : offsets) {
+                const Chunk *neighbor = Neighbor(chunk, o[0], o[1]);
+                if (neighbor && chunk.lod > neighbor->lod + 1) {
+                    chunk.lod = neighbor->lod + 1;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    // 4. 거친 이웃과 닿는 변을 골라서 인덱스 범위 선택
+    m_model->m_meshes.clear();
+    m_stats = Stats();
+    Vector3 vmin(FLT_MAX), vmax(-FLT_MAX);
+    for (auto &it : m_chunks) {
+        Chunk &chunk = it.second;
+
+        int mask = 0;
+        for (int e = 0; e < 4; e++) {
+            const Chunk *neighbor = Neighbor(chunk, offsets[e][0],
+                                             offsets[e][1]);
+            if (neighbor && neighbor->lod > chunk.lod) {
+                mask |= 1 << e;
+            }
+        }
+
+        chunk.mesh->lods = m_indexRanges[chunk.lod * 16 + mask];
+        const MeshLod &range = chunk.mesh->lods->front();
+        chunk.mesh->indexCount = range.indexCount;
+        m_model->AddMesh(chunk.mesh);
+
+        vmin = Vector3::Min(
+            vmin, Vector3(chunk.x * size, chunk.minY, chunk.z * size));
+        vmax = Vector3::Max(vmax, Vector3((chunk.x + 1) * size, chunk.maxY,
+                                          (chunk.z + 1) * size));
+
+        m_stats.numTriangles += range.indexCount / 3;
+        m_stats.vertexBytes += size_t(n + 1) * (n + 1) * sizeof(Vertex);
+    }
+    m_stats.numChunks = m_chunks.size();
+
+    if (!m_chunks.empty()) {
+        MeshBounds &bounds = m_model->m_bounds;
+        DirectX::BoundingBox::CreateFromPoints(bounds.aabb, vmin, vmax);
+        DirectX::BoundingOrientedBox::CreateFromBoundingBox(bounds.obb,
+                                                            bounds.aabb);
+        bounds.sphere.Center = bounds.aabb.Center;
+        bounds.sphere.Radius = (vmax - vmin).Length() * 0.5f;
+        bounds.isValid = 1;
+        m_model->UpdateWorldRow(m_model->m_worldRow);
+    }
+}
+
+} // namespace Moon
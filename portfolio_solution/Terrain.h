@@ -0,0 +1,117 @@
+#pragma once
+
+#include <d3d11.h>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <wrl/client.h>
+
+#include "Model.h"
+
+namespace Moon {
+
+using Microsoft::WRL::ComPtr;
+
+// 월드 좌표 (x, z)의 높이, 여러 스레드에서 동시에 호출됨
+using HeightFunction = std::function<float(float x, float z)>;
+
+// 높이맵 이미지 (R 채널)를 CPU에서 샘플링
+// 원점이 중심인 worldSize x worldSize 영역에 펼침
+class HeightMap {
+  public:
+    bool Load(const std::string &filename, float worldSize,
+              float heightScale);
+
+    // 바이리니어 보간, 영역 밖은 가장자리 값
+    float Sample(float x, float z) const;
+
+  private:
+    std::vector<float> m_heights; // [0, 1]
+    int m_width = 0;
+    int m_height = 0;
+    float m_worldSize = 1.0f;
+    float m_heightScale = 1.0f;
+};
+
+struct TerrainOptions {
+    float chunkSize = 16.0f;    // 청크 한 변의 길이 (월드 단위)
+    int chunkResolution = 64;   // LOD0에서 한 변의 사각형 개수 (2의 거듭제곱)
+    int numLods = 4;            // 한 단계마다 사각형 크기 2배
+    float lodDistance = 24.0f;  // 이 거리부터 LOD1, 거리가 2배마다 한 단계씩
+    float loadRadius = 96.0f;   // 이 안의 청크는 만들고
+    float evictRadius = 128.0f; // 이 밖의 청크는 해제 (loadRadius보다 크게)
+    int maxBuildsPerUpdate = 8; // 한 프레임에 새로 만드는 청크 개수 제한
+    float texScale = 0.25f;     // 월드 단위당 텍스춰 반복 횟수
+};
+
+// 월드를 격자 청크로 나눠서 카메라 주변만 만들어 두는 지형
+// 1. 카메라에서 가까운 순서로 없는 청크들을 작업 스레드에서 동시에 생성
+// 2. 청크마다 거리로 LOD를 고르고, 이웃과 최대 한 단계 차이로 맞춤
+// 3. 더 거친 이웃과 닿는 변은 이웃에 없는 버텍스를 옆으로 붙여서 틈을 막음
+//    (LOD x 4개 변의 조합별 인덱스 범위를 모든 청크가 공유)
+// 청크마다 Mesh 하나를 m_model에 넣으므로 다른 Model과 같은 방식으로 그림
+
+class Terrain {
+  public:
+    struct Stats {
+        size_t numChunks = 0;
+        size_t numTriangles = 0; // 이번 프레임에 그리는 삼각형
+        size_t vertexBytes = 0;
+    };
+
+    void Initialize(ComPtr<ID3D11Device> &device,
+                    ComPtr<ID3D11DeviceContext> &context,
+                    const HeightFunction &heightFunction,
+                    const TerrainOptions &options = TerrainOptions());
+
+    // 카메라 위치에 맞춰 청크 생성/해제와 LOD 선택
+    void Update(ComPtr<ID3D11Device> &device, const Vector3 &eyeWorld);
+
+    Stats GetStats() const { return m_stats; }
+
+    // resolution x resolution 격자의 lod 단계 인덱스
+    // stitchMask의 비트(EDGE_*)가 켜진 변은 한 단계 거친 이웃에 맞춤
+    static void BuildIndices(int resolution, int lod, int stitchMask,
+                             std::vector<uint32_t> &indices);
+
+    enum {
+        EDGE_NEG_X = 1,
+        EDGE_POS_X = 2,
+        EDGE_NEG_Z = 4,
+        EDGE_POS_Z = 8,
+    };
+
+  public:
+    shared_ptr<Model> m_model; // 청크들을 그리는 Model (월드 행렬은 단위 행렬)
+
+  private:
+    struct Chunk {
+        int x = 0;
+        int z = 0;
+        shared_ptr<Mesh> mesh;
+        float minY = 0.0f;
+        float maxY = 0.0f;
+        int lod = 0;
+    };
+
+    static uint64_t ChunkKey(int x, int z);
+
+    void BuildChunkVertices(int x, int z, std::vector<Vertex> &vertices,
+                            float &minY, float &maxY) const;
+
+    float DistanceToChunk(const Chunk &chunk, const Vector3 &eyeWorld) const;
+
+    HeightFunction m_heightFunction;
+    TerrainOptions m_options;
+
+    ComPtr<ID3D11Buffer> m_indexBuffer; // 모든 청크가 공유
+    // [lod * 16 + stitchMask], 청크 Mesh의 lods로 그대로 공유
+    std::vector<std::shared_ptr<const std::vector<MeshLod>>> m_indexRanges;
+    std::unordered_map<uint64_t, Chunk> m_chunks;
+
+    Stats m_stats;
+};
+
+} // namespace Moon
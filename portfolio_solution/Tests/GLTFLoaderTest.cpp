@@ -0,0 +1,167 @@
+#include "TestCommon.h"
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+
+#include "GLTFLoader.h"
+#include "ModelLoader.h"
+
+namespace Moon::Tests {
+
+using namespace std;
+
+namespace {
+
+// 이 파일 기준으로 저장소의 Assets 폴더
+string HelmetPath() {
+    return (filesystem::path(__FILE__).parent_path().parent_path()
+                .parent_path() /
+            "Assets/Models/DamagedHelmet/")
+        .string();
+}
+
+bool Near(const Vector3 &a, const Vector3 &b, float epsilon) {
+    return fabsf(a.x - b.x) <= epsilon && fabsf(a.y - b.y) <= epsilon &&
+           fabsf(a.z - b.z) <= epsilon;
+}
+
+bool Near(const Vector2 &a, const Vector2 &b, float epsilon) {
+    return fabsf(a.x - b.x) <= epsilon && fabsf(a.y - b.y) <= epsilon;
+}
+
+bool SameMaterial(const MeshData &a, const MeshData &b) {
+    return a.albedoTextureFilename == b.albedoTextureFilename &&
+           a.emissiveTextureFilename == b.emissiveTextureFilename &&
+           a.normalTextureFilename == b.normalTextureFilename &&
+           a.heightTextureFilename == b.heightTextureFilename &&
+           a.aoTextureFilename == b.aoTextureFilename &&
+           a.metallicTextureFilename == b.metallicTextureFilename &&
+           a.roughnessTextureFilename == b.roughnessTextureFilename;
+}
+
+// 임시 폴더에 삼각형 하나의 .bin과 json 텍스트로 된 .gltf를 씀
+struct GLTFFixture {
+    string basePath;
+
+    GLTFFixture() {
+        basePath = (filesystem::temp_directory_path() / "GLTFLoaderTest/")
+                       .string();
+        filesystem::create_directories(basePath);
+        const float positions[9] = {0, 0, 0, 1, 0, 0, 0, 1, 0};
+        ofstream(basePath + "triangle.bin", ios::binary)
+            .write((const char *)positions, sizeof(positions));
+    }
+
+    ~GLTFFixture() {
+        error_code ec;
+        filesystem::remove_all(basePath, ec);
+    }
+
+    bool Load(const string &nodes, const string &accessor,
+              const string &bufferView, const string &extra = "") {
+        ofstream(basePath + "test.gltf")
+            << R"({"asset": {"version": "2.0"}, "scene": 0,)"
+            << R"("scenes": [{"nodes": [0]}],)"
+            << R"("nodes": )" << nodes << ","
+            << R"("meshes": [{"primitives": [{"attributes": {"POSITION": 0})"
+            << extra << "}]}],"
+            << R"("accessors": [)" << accessor << "],"
+            << R"("bufferViews": [)" << bufferView << "],"
+            << R"("buffers": [{"uri": "triangle.bin", "byteLength": 36}]})";
+
+        vector<MeshData> meshes;
+        return GLTFLoader::Load(basePath, "test.gltf", false, meshes);
+    }
+};
+
+const char *VALID_NODES = R"([{"mesh": 0}])";
+const char *VALID_ACCESSOR =
+    R"({"bufferView": 0, "componentType": 5126, "count": 3, "type": "VEC3"})";
+const char *VALID_VIEW = R"({"buffer": 0, "byteLength": 36})";
+
+} // namespace
+
+// 같은 파일을 직접 읽은 결과와 Assimp로 읽은 결과가 같아야 함
+TEST(GLTFLoaderMatchesAssimp) {
+    ModelLoader native, assimp;
+    assimp.m_useNativeGLTF = false;
+    for (ModelLoader *loader : {&native, &assimp}) {
+        // 용접과 순서 최적화는 두 경로가 같으므로 읽은 그대로 비교
+        loader->m_weldVertices = false;
+        loader->m_optimizeMeshes = false;
+        loader->Load(HelmetPath(), "DamagedHelmet.gltf", false);
+    }
+
+    CHECK(!native.meshes.empty());
+    CHECK(native.meshes.size() == assimp.meshes.size());
+    for (size_t m = 0;
+         m < native.meshes.size() && m < assimp.meshes.size(); m++) {
+        const MeshData &a = native.meshes[m];
+        const MeshData &b = assimp.meshes[m];
+
+        CHECK(a.indices == b.indices);
+        CHECK(SameMaterial(a, b));
+        CHECK(a.vertices.size() == b.vertices.size());
+
+        size_t numDifferent = 0;
+        for (size_t i = 0; i < a.vertices.size() && i < b.vertices.size();
+             i++) {
+            const Vertex &va = a.vertices[i];
+            const Vertex &vb = b.vertices[i];
+            if (!Near(va.position, vb.position, 1e-4f) ||
+                !Near(va.normalModel, vb.normalModel, 1e-4f) ||
+                !Near(va.texcoord, vb.texcoord, 1e-6f) ||
+                !Near(va.tangentModel, vb.tangentModel, 1e-3f)) {
+                numDifferent++;
+            }
+        }
+        CHECK(numDifferent == 0);
+    }
+}
+
+// 잘못된 파일은 범위 밖을 읽지 않고 false (ModelLoader가 Assimp로 다시 읽음)
+TEST(GLTFLoaderRejectsMalformedFiles) {
+    GLTFFixture fixture;
+
+    CHECK(fixture.Load(VALID_NODES, VALID_ACCESSOR, VALID_VIEW));
+
+    // 노드 순환
+    CHECK(!fixture.Load(R"([{"mesh": 0, "children": [1]}, {"children": [0]}])",
+                        VALID_ACCESSOR, VALID_VIEW));
+    CHECK(!fixture.Load(R"([{"mesh": 7}])", VALID_ACCESSOR, VALID_VIEW));
+    CHECK(!fixture.Load(VALID_NODES,
+                        R"({"bufferView": 3, "componentType": 5126,)"
+                        R"("count": 3, "type": "VEC3"})",
+                        VALID_VIEW));
+
+    // 버퍼보다 긴 accessor와 bufferView
+    CHECK(!fixture.Load(VALID_NODES,
+                        R"({"bufferView": 0, "componentType": 5126,)"
+                        R"("count": 4, "type": "VEC3"})",
+                        VALID_VIEW));
+    CHECK(!fixture.Load(VALID_NODES,
+                        R"({"bufferView": 0, "componentType": 5126,)"
+                        R"("count": 1537228672809129302, "type": "VEC3"})",
+                        R"({"buffer": 0, "byteLength": 36,)"
+                        R"("byteStride": 12})"));
+    CHECK(!fixture.Load(VALID_NODES, VALID_ACCESSOR,
+                        R"({"buffer": 0, "byteLength": 36,)"
+                        R"("byteOffset": 18446744073709551600})"));
+    CHECK(!fixture.Load(VALID_NODES, VALID_ACCESSOR,
+                        R"({"buffer": 0, "byteLength": 40})"));
+
+    // 없는 재질과 인덱스
+    CHECK(!fixture.Load(VALID_NODES, VALID_ACCESSOR, VALID_VIEW,
+                        R"(, "material": 2)"));
+    CHECK(!fixture.Load(VALID_NODES, VALID_ACCESSOR, VALID_VIEW,
+                        R"(, "indices": -1)"));
+
+    // 버텍스가 없는 primitive는 빈 메쉬
+    CHECK(fixture.Load(VALID_NODES,
+                       R"({"bufferView": 0, "componentType": 5126,)"
+                       R"("count": 0, "type": "VEC3"})",
+                       VALID_VIEW));
+}
+
+} // namespace Moon::Tests
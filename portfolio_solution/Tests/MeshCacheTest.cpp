@@ -0,0 +1,110 @@
+#include "TestCommon.h"
+#include "TestMeshes.h"
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include "MeshCache.h"
+
+namespace Moon::Tests {
+
+using namespace std;
+
+namespace {
+
+const uint64_t OPTIONS_HASH = 0x1234;
+
+// 임시 폴더에 원본 파일 하나와 메쉬 여러 개(LOD 포함)의 캐시를 씀
+struct CacheFixture {
+    string basePath;
+    string filename = "model.gltf";
+    vector<MeshData> meshes;
+
+    CacheFixture() {
+        basePath = (filesystem::temp_directory_path() / "MeshCacheTest/")
+                       .string();
+        filesystem::create_directories(basePath);
+        ofstream(basePath + filename) << "{}";
+
+        for (int n : {3, 20, 64}) {
+            MeshData mesh = MakeTestSphere(n);
+            const auto half = mesh.indices.begin() + mesh.indices.size() / 2;
+            mesh.lodIndices.emplace_back(mesh.indices.begin(), half);
+            mesh.lodIndices.push_back({0, 1, 2});
+            mesh.albedoTextureFilename = "albedo" + to_string(n) + ".png";
+            meshes.push_back(mesh);
+        }
+        meshes.push_back(MeshData()); // 빈 메쉬
+
+        MeshCache::Write(basePath, filename, false, OPTIONS_HASH, meshes,
+                         {basePath + filename});
+    }
+
+    ~CacheFixture() {
+        error_code ec;
+        filesystem::remove_all(basePath, ec);
+    }
+};
+
+bool SameMesh(const MeshData &a, const MeshData &b) {
+    return a.vertices.size() == b.vertices.size() &&
+           memcmp(a.vertices.data(), b.vertices.data(),
+                  a.vertices.size() * sizeof(Vertex)) == 0 &&
+           a.indices == b.indices && a.lodIndices == b.lodIndices &&
+           a.albedoTextureFilename == b.albedoTextureFilename;
+}
+
+} // namespace
+
+TEST(MeshCacheRoundTrip) {
+    CacheFixture fixture;
+
+    vector<MeshData> meshes;
+    CHECK(MeshCache::Read(fixture.basePath, fixture.filename, false,
+                          OPTIONS_HASH, meshes));
+    CHECK(meshes.size() == fixture.meshes.size());
+    for (size_t i = 0; i < meshes.size() && i < fixture.meshes.size(); i++) {
+        CHECK(SameMesh(meshes[i], fixture.meshes[i]));
+    }
+
+    // revertNormals나 처리 옵션이 다르면 다시 만들어야 함
+    CHECK(!MeshCache::Read(fixture.basePath, fixture.filename, true,
+                           OPTIONS_HASH, meshes));
+    CHECK(!MeshCache::Read(fixture.basePath, fixture.filename, false,
+                           OPTIONS_HASH + 1, meshes));
+}
+
+// 수정 시간만 바뀌면 해시로 확인해서 그대로 쓰고, 내용이 바뀌면 다시 만듦
+TEST(MeshCacheChecksSourceChanges) {
+    CacheFixture fixture;
+    const string source = fixture.basePath + fixture.filename;
+
+    vector<MeshData> meshes;
+    filesystem::last_write_time(source, filesystem::last_write_time(source) +
+                                            chrono::seconds(10));
+    CHECK(MeshCache::Read(fixture.basePath, fixture.filename, false,
+                          OPTIONS_HASH, meshes));
+
+    ofstream(source) << "[]";
+    CHECK(!MeshCache::Read(fixture.basePath, fixture.filename, false,
+                           OPTIONS_HASH, meshes));
+}
+
+TEST(MeshCacheRejectsTruncatedFile) {
+    CacheFixture fixture;
+
+    const string cacheFilename =
+        MeshCache::GetCacheFilename(fixture.basePath, fixture.filename);
+    const auto size = filesystem::file_size(cacheFilename);
+
+    for (uintmax_t newSize : {size - 1, size / 2, uintmax_t(64)}) {
+        filesystem::resize_file(cacheFilename, newSize);
+        vector<MeshData> meshes;
+        CHECK(!MeshCache::Read(fixture.basePath, fixture.filename, false,
+                               OPTIONS_HASH, meshes));
+    }
+}
+
+} // namespace Moon::Tests
@@ -0,0 +1,139 @@
+#include "TestCommon.h"
+#include "TestMeshes.h"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+#include "MeshCodec.h"
+
+namespace Moon::Tests {
+
+using namespace std;
+
+namespace {
+
+bool SameVertices(const vector<Vertex> &a, const vector<Vertex> &b) {
+    return a.size() == b.size() &&
+           memcmp(a.data(), b.data(), a.size() * sizeof(Vertex)) == 0;
+}
+
+template <typename Func> double MeasureMs(int repeat, Func func) {
+    const auto startTime = chrono::steady_clock::now();
+    for (int r = 0; r < repeat; r++) {
+        func();
+    }
+    return chrono::duration<double, milli>(chrono::steady_clock::now() -
+                                           startTime)
+               .count() /
+           repeat;
+}
+
+} // namespace
+
+TEST(MeshCodecRoundTrip) {
+    const MeshData sphere = MakeTestSphere(64);
+
+    // 블록(16개) 경계 앞뒤의 개수들
+    for (size_t count : {0, 1, 2, 15, 16, 17, 33, 4225}) {
+        const vector<Vertex> vertices(sphere.vertices.begin(),
+                                      sphere.vertices.begin() + count);
+        const vector<uint32_t> indices(sphere.indices.begin(),
+                                       sphere.indices.begin() + count);
+
+        vector<uint8_t> encoded;
+        MeshCodec::EncodeVertices(vertices, encoded);
+        MeshCodec::EncodeIndices(indices, encoded);
+
+        const uint8_t *ptr = encoded.data();
+        const uint8_t *end = encoded.data() + encoded.size();
+        vector<Vertex> decodedVertices;
+        vector<uint32_t> decodedIndices;
+        CHECK(MeshCodec::DecodeVertices(ptr, end, count, decodedVertices));
+        CHECK(MeshCodec::DecodeIndices(ptr, end, count, decodedIndices));
+        CHECK(ptr == end);
+        CHECK(SameVertices(decodedVertices, vertices));
+        CHECK(decodedIndices == indices);
+    }
+
+    // 이웃과 상관없는 값 (비트 수가 큰 블록)
+    mt19937 random(1);
+    vector<uint32_t> noise(100000);
+    for (auto &x : noise) {
+        x = random();
+    }
+    vector<uint8_t> encoded;
+    MeshCodec::EncodeIndices(noise, encoded);
+    const uint8_t *ptr = encoded.data();
+    vector<uint32_t> decoded;
+    CHECK(MeshCodec::DecodeIndices(ptr, encoded.data() + encoded.size(),
+                                   noise.size(), decoded));
+    CHECK(decoded == noise);
+}
+
+TEST(MeshCodecRejectsTruncatedInput) {
+    vector<uint32_t> indices(1000);
+    for (size_t i = 0; i < indices.size(); i++) {
+        indices[i] = uint32_t(i * 3 % 977);
+    }
+    vector<uint8_t> encoded;
+    MeshCodec::EncodeIndices(indices, encoded);
+
+    // 어디서 잘려도 실패해야 함
+    size_t numAccepted = 0;
+    for (size_t size = 0; size < encoded.size(); size++) {
+        const uint8_t *ptr = encoded.data();
+        vector<uint32_t> decoded;
+        numAccepted += MeshCodec::DecodeIndices(ptr, encoded.data() + size,
+                                                indices.size(), decoded);
+    }
+    CHECK(numAccepted == 0);
+
+    // 데이터로 불가능한 개수는 메모리를 잡기 전에 실패
+    const uint8_t *ptr = encoded.data();
+    vector<uint32_t> decoded;
+    CHECK(!MeshCodec::DecodeIndices(ptr, encoded.data() + encoded.size(),
+                                    size_t(1) << 40, decoded));
+}
+
+// 압축을 풀어서 읽는 것과 압축하지 않은 캐시(memcpy)를 읽는 것 비교
+TEST(MeshCodecDecodeBenchmark) {
+    const MeshData sphere = MakeTestSphere(400);
+
+    vector<uint8_t> encoded;
+    MeshCodec::EncodeVertices(sphere.vertices, encoded);
+    MeshCodec::EncodeIndices(sphere.indices, encoded);
+
+    // 압축하지 않은 캐시는 버텍스와 인덱스를 그대로 복사
+    const size_t vertexBytes = sphere.vertices.size() * sizeof(Vertex);
+    const size_t rawBytes =
+        vertexBytes + sphere.indices.size() * sizeof(uint32_t);
+    vector<uint8_t> raw(rawBytes), copied(rawBytes);
+    memcpy(raw.data(), sphere.vertices.data(), vertexBytes);
+    memcpy(raw.data() + vertexBytes, sphere.indices.data(),
+           rawBytes - vertexBytes);
+
+    vector<Vertex> vertices;
+    vector<uint32_t> indices;
+    const double decodeMs = MeasureMs(10, [&] {
+        const uint8_t *ptr = encoded.data();
+        const uint8_t *end = encoded.data() + encoded.size();
+        MeshCodec::DecodeVertices(ptr, end, sphere.vertices.size(), vertices);
+        MeshCodec::DecodeIndices(ptr, end, sphere.indices.size(), indices);
+    });
+    const double copyMs = MeasureMs(10, [&] {
+        memcpy(copied.data(), raw.data(), raw.size());
+    });
+
+    CHECK(SameVertices(vertices, sphere.vertices));
+    CHECK(indices == sphere.indices);
+
+    cout << "  raw " << rawBytes / 1024 << " KB, copy " << copyMs
+         << " ms (" << rawBytes / copyMs * 1e-6 << " GB/s)" << endl;
+    cout << "  compressed " << encoded.size() / 1024 << " KB, decode "
+         << decodeMs << " ms (" << rawBytes / decodeMs * 1e-6 << " GB/s)"
+         << endl;
+}
+
+} // namespace Moon::Tests
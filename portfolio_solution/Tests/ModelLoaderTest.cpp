@@ -0,0 +1,81 @@
+#include "TestCommon.h"
+
+#include "ModelLoader.h"
+
+// ProcessMesh()는 메쉬 크기와 상관없이 최종 버퍼(버텍스, 인덱스)만 할당해야 함
+// (중간 vector와 복사가 있으면 push_back 재할당과 복사로 횟수가 늘어남)
+
+namespace Moon::Tests {
+
+namespace {
+
+#ifdef _DEBUG
+// MSVC 디버그 빌드는 컨테이너마다 _Container_proxy를 따로 할당
+constexpr size_t kMaxAllocations = 32;
+#else
+// 버텍스와 인덱스 버퍼 하나씩 (텍스춰 이름은 재질에 없으므로 0)
+constexpr size_t kMaxAllocations = 2;
+#endif
+
+// numQuads x 1 격자 (버텍스 2 * (numQuads + 1)개, 삼각형 2 * numQuads개)
+aiMesh *MakeStrip(unsigned int numQuads) {
+    aiMesh *mesh = new aiMesh();
+    mesh->mNumVertices = 2 * (numQuads + 1);
+    mesh->mVertices = new aiVector3D[mesh->mNumVertices];
+    mesh->mNormals = new aiVector3D[mesh->mNumVertices];
+    mesh->mTextureCoords[0] = new aiVector3D[mesh->mNumVertices];
+    for (unsigned int i = 0; i < mesh->mNumVertices; i++) {
+        const float x = float(i / 2), y = float(i % 2);
+        mesh->mVertices[i] = aiVector3D(x, y, 0.0f);
+        mesh->mNormals[i] = aiVector3D(0.0f, 0.0f, 1.0f);
+        mesh->mTextureCoords[0][i] = aiVector3D(x / numQuads, y, 0.0f);
+    }
+
+    mesh->mNumFaces = 2 * numQuads;
+    mesh->mFaces = new aiFace[mesh->mNumFaces];
+    for (unsigned int q = 0; q < numQuads; q++) {
+        const unsigned int v = q * 2;
+        const unsigned int tris[2][3] = {{v, v + 1, v + 2},
+                                         {v + 1, v + 3, v + 2}};
+        for (int t = 0; t < 2; t++) {
+            aiFace &face = mesh->mFaces[q * 2 + t];
+            face.mNumIndices = 3;
+            face.mIndices = new unsigned int[3];
+            for (int k = 0; k < 3; k++) {
+                face.mIndices[k] = tris[t][k];
+            }
+        }
+    }
+    mesh->mMaterialIndex = 0;
+    return mesh;
+}
+
+size_t CountProcessMesh(unsigned int numQuads) {
+    aiScene scene;
+    scene.mNumMaterials = 1;
+    scene.mMaterials = new aiMaterial *[1]{new aiMaterial()};
+    scene.mNumMeshes = 1;
+    scene.mMeshes = new aiMesh *[1]{MakeStrip(numQuads)};
+
+    ModelLoader loader;
+    MeshData meshData;
+    const size_t count = CountAllocations([&] {
+        meshData = loader.ProcessMesh(scene.mMeshes[0], &scene);
+    });
+
+    CHECK(meshData.vertices.size() == 2 * (numQuads + 1));
+    CHECK(meshData.indices.size() == 6 * numQuads);
+    return count;
+}
+
+} // namespace
+
+TEST(ProcessMeshAllocationsAreBounded) {
+    const size_t small = CountProcessMesh(16);
+    const size_t large = CountProcessMesh(100000);
+
+    CHECK(small <= kMaxAllocations);
+    CHECK(large == small);
+}
+
+} // namespace Moon::Tests
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+// 외부 라이브러리 없이 쓰는 작은 테스트 러너
+// TEST(이름)으로 등록하면 TestMain.cpp의 main()이 순서대로 실행하고
+// CHECK()가 하나라도 실패하면 0이 아닌 값을 반환
+
+namespace Moon::Tests {
+
+using TestFunction = void (*)();
+
+struct TestRegistrar {
+    TestRegistrar(const char *name, TestFunction func);
+};
+
+void Fail(const char *file, int line, const char *expression);
+
+// func 안에서 일어난 operator new 호출 횟수 (모든 스레드 합계)
+size_t CountAllocations(const std::function<void()> &func);
+
+} // namespace Moon::Tests
+
+#define TEST(name)                                                             \
+    static void name();                                                        \
+    static Moon::Tests::TestRegistrar name##Registrar(#name, name);            \
+    static void name()
+
+#define CHECK(expression)                                                      \
+    do {                                                                       \
+        if (!(expression)) {                                                   \
+            Moon::Tests::Fail(__FILE__, __LINE__, #expression);                \
+        }                                                                      \
+    } while (false)
@@ -0,0 +1,86 @@
+#include "TestCommon.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <vector>
+
+namespace Moon::Tests {
+
+using namespace std;
+
+namespace {
+
+struct TestCase {
+    const char *name;
+    TestFunction func;
+};
+
+vector<TestCase> &Registry() {
+    static vector<TestCase> tests;
+    return tests;
+}
+
+int g_numFailures = 0;
+
+atomic<bool> g_countAllocations = false;
+atomic<size_t> g_numAllocations = 0;
+
+} // namespace
+
+TestRegistrar::TestRegistrar(const char *name, TestFunction func) {
+    Registry().push_back({name, func});
+}
+
+void Fail(const char *file, int line, const char *expression) {
+    cout << file << "(" << line << "): CHECK(" << expression << ") failed"
+         << endl;
+    g_numFailures++;
+}
+
+size_t CountAllocations(const function<void()> &func) {
+    g_numAllocations = 0;
+    g_countAllocations = true;
+    func();
+    g_countAllocations = false;
+    return g_numAllocations;
+}
+
+} // namespace Moon::Tests
+
+// 할당 횟수를 세기 위해 전역 operator new를 교체 (테스트 실행 파일에서만)
+void *operator new(size_t size) {
+    if (Moon::Tests::g_countAllocations) {
+        Moon::Tests::g_numAllocations++;
+    }
+    if (void *ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new[](size_t size) { return operator new(size); }
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+
+void operator delete[](void *ptr, size_t) noexcept { std::free(ptr); }
+
+int main() {
+    using namespace Moon::Tests;
+
+    for (const auto &test : Registry()) {
+        const int numFailures = g_numFailures;
+        test.func();
+        std::cout << (g_numFailures == numFailures ? "[PASS] " : "[FAIL] ")
+                  << test.name << std::endl;
+    }
+
+    std::cout << Registry().size() << " tests, " << g_numFailures
+              << " failures" << std::endl;
+    return g_numFailures ? 1 : 0;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cmath>
+
+#include "MeshData.h"
+
+namespace Moon::Tests {
+
+// 위도/경도 격자 구 (버텍스 (n + 1)^2개, 삼각형 2 * n^2개)
+// 실제 메쉬처럼 이웃 버텍스끼리 값이 비슷해서 압축 테스트에 사용
+inline MeshData MakeTestSphere(int n) {
+    MeshData mesh;
+    mesh.vertices.reserve(size_t(n + 1) * (n + 1));
+    for (int i = 0; i <= n; i++) {
+        for (int j = 0; j <= n; j++) {
+            const float theta = 3.141592f * i / n;
+            const float phi = 6.283185f * j / n;
+            Vertex v;
+            v.position = Vector3(sinf(theta) * cosf(phi), cosf(theta),
+                                 sinf(theta) * sinf(phi));
+            v.normalModel = v.position;
+            v.texcoord = Vector2(float(j) / n, float(i) / n);
+            v.tangentModel = Vector3(-sinf(phi), 0.0f, cosf(phi));
+            mesh.vertices.push_back(v);
+        }
+    }
+
+    mesh.indices.reserve(size_t(n) * n * 6);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            const uint32_t a = i * (n + 1) + j;
+            mesh.indices.insert(mesh.indices.end(),
+                                {a, a + 1, a + n + 1, a + 1, a + n + 2,
+                                 a + n + 1});
+        }
+    }
+    return mesh;
+}
+
+} // namespace Moon::Tests
@@ -0,0 +1,53 @@
+#include "TestCommon.h"
+
+#include "VertexWelder.h"
+
+namespace Moon::Tests {
+
+using namespace std;
+
+namespace {
+
+// (x, 0, 0)에 놓인 버텍스 여러 개 (인덱스는 0, 1, 2, ...)
+MeshData MakePoints(const vector<float> &xs) {
+    MeshData meshData;
+    for (const float x : xs) {
+        Vertex v;
+        v.position = Vector3(x, 0.0f, 0.0f);
+        meshData.vertices.push_back(v);
+        meshData.indices.push_back(uint32_t(meshData.indices.size()));
+    }
+    return meshData;
+}
+
+} // namespace
+
+TEST(VertexWelderMergesNearVertices) {
+    MeshData meshData = MakePoints({0.0f, 1.0f, 1.0f + 1e-7f, 0.5f});
+
+    CHECK(VertexWelder::Weld(meshData) == 1);
+    CHECK(meshData.vertices.size() == 3);
+    CHECK(meshData.indices[2] == meshData.indices[1]);
+}
+
+// 단위 크기가 아닌 메시에서도 멀리 떨어진 점은 합치지 않음
+TEST(VertexWelderKeepsDistantVerticesApart) {
+    const float scale = 1000.0f; // 단위 크기가 아닌 메시
+    MeshData meshData =
+        MakePoints({0.0f, 0.3f * scale, 0.7f * scale, 1.0f * scale});
+
+    CHECK(VertexWelder::Weld(meshData) == 0);
+    CHECK(meshData.vertices.size() == 4);
+}
+
+// 허용 오차는 메시 크기에 비례하므로 크게 만든 메시도 같은 결과
+TEST(VertexWelderScalesEpsilonWithMesh) {
+    const float scale = 1000.0f;
+    MeshData meshData =
+        MakePoints({0.0f, 1.0f * scale, 1.0f * scale + 1e-4f, 0.5f * scale});
+
+    CHECK(VertexWelder::Weld(meshData) == 1);
+    CHECK(meshData.vertices.size() == 3);
+}
+
+} // namespace Moon::Tests
@@ -0,0 +1,149 @@
+#include "TextureCache.h"
+
+#include <algorithm>
+#include <filesystem>
+
+#include "MappedFile.h"
+
+namespace Moon {
+
+using namespace std;
+
+namespace {
+
+string CanonicalPath(const string &filename) {
+
+    if (filename.empty()) {
+        return "";
+    }
+
+    error_code ec;
+    string path = filesystem::weakly_canonical(filename, ec).string();
+    if (ec) {
+        path = filename;
+    }
+
+    // 윈도우 경로는 대소문자 구분 X
+    transform(path.begin(), path.end(), path.begin(),
+              [](char c) { return char(tolower((unsigned char)c)); });
+
+    return path;
+}
+
+} // namespace
+
+TextureCache &TextureCache::Get() {
+    static TextureCache cache;
+    return cache;
+}
+
+string TextureCache::MakeKey(const string &filename,
+                             const string &secondFilename, bool isSRGB) {
+    return CanonicalPath(filename) + "|" + CanonicalPath(secondFilename) +
+           (isSRGB ? "|srgb" : "|linear");
+}
+
+uint64_t TextureCache::HashContents(const MappedFile *file,
+                                    const MappedFile *secondFile,
+                                    bool isSRGB) {
+
+    uint64_t hash = 0xcbf29ce484222325ull;
+
+    for (const auto *f : {file, secondFile}) {
+        if (!f) {
+            hash = HashBytes((const uint8_t *)"|", 1, hash);
+            continue;
+        }
+
+        if (!f->IsOpen()) {
+            return 0;
+        }
+        hash = HashBytes(f->Data(), f->Size(), hash);
+        hash = HashBytes((const uint8_t *)"|", 1, hash);
+    }
+
+    const uint8_t srgb = isSRGB ? 1 : 0;
+    hash = HashBytes(&srgb, 1, hash);
+
+    return hash == 0 ? 1 : hash; // 0은 실패로 사용
+}
+
+shared_ptr<CachedTexture> TextureCache::FindByKey(const string &key) {
+
+    lock_guard<mutex> lock(m_mutex);
+
+    auto it = m_byKey.find(key);
+    if (it == m_byKey.end()) {
+        return nullptr;
+    }
+
+    auto texture = it->second.lock();
+    if (!texture) {
+        m_byKey.erase(it); // 이미 해제됨
+        return nullptr;
+    }
+
+    RecordHitLocked(texture);
+
+    return texture;
+}
+
+shared_ptr<CachedTexture> TextureCache::FindByContent(uint64_t contentHash) {
+
+    if (contentHash == 0) {
+        return nullptr;
+    }
+
+    lock_guard<mutex> lock(m_mutex);
+
+    auto it = m_byContent.find(contentHash);
+    if (it == m_byContent.end()) {
+        return nullptr;
+    }
+
+    auto texture = it->second.lock();
+    if (!texture) {
+        m_byContent.erase(it);
+        return nullptr;
+    }
+
+    RecordHitLocked(texture);
+
+    return texture;
+}
+
+void TextureCache::Insert(const string &key, uint64_t contentHash,
+                          const shared_ptr<CachedTexture> &texture) {
+
+    lock_guard<mutex> lock(m_mutex);
+
+    m_stats.misses++;
+
+    m_byKey[key] = texture;
+    if (contentHash != 0) {
+        m_byContent[contentHash] = texture;
+    }
+}
+
+void TextureCache::AddKey(const string &key,
+                          const shared_ptr<CachedTexture> &texture) {
+    lock_guard<mutex> lock(m_mutex);
+    m_byKey[key] = texture;
+}
+
+void TextureCache::RecordHit(const shared_ptr<CachedTexture> &texture) {
+    lock_guard<mutex> lock(m_mutex);
+    RecordHitLocked(texture);
+}
+
+void TextureCache::RecordHitLocked(const shared_ptr<CachedTexture> &texture) {
+    m_stats.hits++;
+    m_stats.bytesSaved += texture->bytes;
+}
+
+TextureCache::Stats TextureCache::GetStats() {
+    lock_guard<mutex> lock(m_mutex);
+    return m_stats;
+}
+
+} // namespace Moon
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <d3d11.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <wrl/client.h>
+
+#include "MappedFile.h"
+
+namespace Moon {
+
+using Microsoft::WRL::ComPtr;
+
+// 여러 Mesh/Model이 공유하는 텍스춰
+struct CachedTexture {
+    ComPtr<ID3D11Texture2D> texture;
+    ComPtr<ID3D11ShaderResourceView> srv;
+    size_t bytes = 0; // 밉맵 포함 GPU 메모리 (대략)
+};
+
+// 프로그램 전체에서 공유하는 텍스춰 캐시
+// 1. (정규화된 경로 + sRGB 여부)로 찾고
+// 2. 없으면 파일 내용의 해시로 찾아서 이름만 다른 같은 파일도 공유
+// 항목은 weak_ptr로 들고 있으므로 사용하는 Mesh가 모두 사라지면 같이 해제
+
+class TextureCache {
+  public:
+    struct Stats {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t bytesSaved = 0; // 다시 읽지 않아서 아낀 GPU 메모리
+    };
+
+    static TextureCache &Get();
+
+    // metallic/roughness를 합치는 경우 secondFilename 사용
+    static std::string MakeKey(const std::string &filename,
+                               const std::string &secondFilename,
+                               bool isSRGB);
+
+    // 매핑해둔 파일 내용의 해시 (파일이 없으면 nullptr, 열기 실패 시 0)
+    // 작업 스레드에서 호출 가능
+    static uint64_t HashContents(const MappedFile *file,
+                                 const MappedFile *secondFile, bool isSRGB);
+
+    std::shared_ptr<CachedTexture> FindByKey(const std::string &key);
+    std::shared_ptr<CachedTexture> FindByContent(uint64_t contentHash);
+
+    // 새로 읽은 텍스춰 등록 (miss)
+    void Insert(const std::string &key, uint64_t contentHash,
+                const std::shared_ptr<CachedTexture> &texture);
+
+    // 내용으로 찾은 텍스춰를 다음부터는 경로로 바로 찾을 수 있도록 등록
+    void AddKey(const std::string &key,
+                const std::shared_ptr<CachedTexture> &texture);
+
+    // 캐시 밖에서 중복을 찾은 경우(같은 Model 안에서 같은 파일)도 기록
+    void RecordHit(const std::shared_ptr<CachedTexture> &texture);
+
+    Stats GetStats();
+
+  private:
+    void RecordHitLocked(const std::shared_ptr<CachedTexture> &texture);
+
+    std::unordered_map<std::string, std::weak_ptr<CachedTexture>> m_byKey;
+    std::unordered_map<uint64_t, std::weak_ptr<CachedTexture>> m_byContent;
+    std::mutex m_mutex;
+    Stats m_stats;
+};
+
+} // namespace Moon
@@ -0,0 +1,118 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+namespace Moon {
+
+using namespace std;
+
+ThreadPool::ThreadPool(size_t numThreads) {
+
+    if (numThreads == 0) {
+        const size_t hardwareThreads = size_t(thread::hardware_concurrency());
+        numThreads = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+    }
+
+    m_workers.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; i++) {
+        m_workers.emplace_back([this] { WorkerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_condition.notify_all();
+
+    for (auto &worker : m_workers) {
+        worker.join();
+    }
+}
+
+ThreadPool &ThreadPool::Get() {
+    static ThreadPool pool;
+    return pool;
+}
+
+void ThreadPool::Enqueue(function<void()> task) {
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_tasks.push(std::move(task));
+    }
+    m_condition.notify_one();
+}
+
+void ThreadPool::WorkerLoop() {
+    while (true) {
+        function<void()> task;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_condition.wait(lock,
+                             [this] { return m_stop || !m_tasks.empty(); });
+            if (m_stop && m_tasks.empty()) {
+                return;
+            }
+            task = std::move(m_tasks.front());
+            m_tasks.pop();
+        }
+        task();
+    }
+}
+
+void ThreadPool::ParallelFor(size_t count,
+                             const function<void(size_t)> &func) {
+
+    if (count == 0) {
+        return;
+    }
+
+    if (count == 1 || m_workers.empty()) {
+        for (size_t i = 0; i < count; i++) {
+            func(i);
+        }
+        return;
+    }
+
+    // 늦게 시작한 작업 스레드가 ParallelFor()가 끝난 후에 접근할 수 있으므로
+    // 공유 상태는 shared_ptr로 관리
+    struct State {
+        atomic<size_t> next{0};
+        atomic<size_t> finished{0};
+        size_t count = 0;
+        const function<void(size_t)> *func = nullptr;
+        mutex doneMutex;
+        condition_variable done;
+    };
+
+    auto state = make_shared<State>();
+    state->count = count;
+    state->func = &func;
+
+    // 인덱스를 하나씩 가져가서 실행 (가져갈 인덱스가 없으면 func에 접근 X)
+    auto work = [](State &s) {
+        size_t i;
+        while ((i = s.next.fetch_add(1)) < s.count) {
+            (*s.func)(i);
+            if (s.finished.fetch_add(1) + 1 == s.count) {
+                lock_guard<mutex> lock(s.doneMutex);
+                s.done.notify_all();
+            }
+        }
+    };
+
+    const size_t numHelpers = min(m_workers.size(), count - 1);
+    for (size_t i = 0; i < numHelpers; i++) {
+        Enqueue([state, work] { work(*state); });
+    }
+
+    work(*state);
+
+    unique_lock<mutex> lock(state->doneMutex);
+    state->done.wait(lock, [&] { return state->finished == count; });
+}
+
+} // namespace Moon
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace Moon {
+
+// 작업 스레드들을 미리 만들어두고 재사용하는 스레드 풀
+// ParallelFor()는 [0, count) 범위를 여러 스레드에 나눠서 실행하고
+// 모두 끝날 때까지 기다림 (호출한 스레드도 같이 일함)
+
+// 작업 안에서 다시 ParallelFor()를 호출해도 멈추지 않도록
+// 남은 작업은 호출한 스레드가 직접 처리함
+
+class ThreadPool {
+  public:
+    // numThreads가 0이면 (하드웨어 스레드 개수 - 1)
+    explicit ThreadPool(size_t numThreads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    // 프로그램 전체에서 공유하는 풀
+    static ThreadPool &Get();
+
+    void ParallelFor(size_t count, const std::function<void(size_t)> &func);
+
+    size_t NumThreads() const { return m_workers.size(); }
+
+  private:
+    void Enqueue(std::function<void()> task);
+    void WorkerLoop();
+
+    std::vector<std::thread> m_workers;
+    std::queue<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_stop = false;
+};
+
+} // namespace Moon
@@ -0,0 +1,382 @@
+#include "TriangleBVH.h"
+
+#include <algorithm>
+#include <xmmintrin.h>
+
+namespace Moon {
+
+using namespace std;
+
+namespace {
+
+struct Aabb {
+    Vector3 min = Vector3(FLT_MAX);
+    Vector3 max = Vector3(-FLT_MAX);
+
+    void Grow(const Vector3 &p) {
+        min = Vector3::Min(min, p);
+        max = Vector3::Max(max, p);
+    }
+    void Grow(const Aabb &b) {
+        min = Vector3::Min(min, b.min);
+        max = Vector3::Max(max, b.max);
+    }
+    float Area() const {
+        const Vector3 d = max - min;
+        return d.x < 0.0f ? 0.0f : 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+    }
+};
+
+// 세 축의 슬랩을 한꺼번에 계산, 안 만나면 FLT_MAX
+// 노드의 네 번째 값(leftFirst, count)은 마스크로 지우고 [0, tMax]로 채움
+inline float IntersectNode(const float *nodeMin, const float *nodeMax,
+                           __m128 origin, __m128 invDir, float tMax) {
+    const __m128 mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+    const __m128 t0 =
+        _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(nodeMin), origin), invDir);
+    const __m128 t1 =
+        _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(nodeMax), origin), invDir);
+    __m128 tNear = _mm_and_ps(_mm_min_ps(t0, t1), mask);
+    __m128 tFar = _mm_or_ps(_mm_and_ps(_mm_max_ps(t0, t1), mask),
+                            _mm_andnot_ps(mask, _mm_set1_ps(tMax)));
+
+    tNear = _mm_max_ps(tNear, _mm_shuffle_ps(tNear, tNear, 0x4e));
+    tNear = _mm_max_ps(tNear, _mm_shuffle_ps(tNear, tNear, 0xb1));
+    tFar = _mm_min_ps(tFar, _mm_shuffle_ps(tFar, tFar, 0x4e));
+    tFar = _mm_min_ps(tFar, _mm_shuffle_ps(tFar, tFar, 0xb1));
+
+    const float enter = _mm_cvtss_f32(tNear);
+    return enter <= _mm_cvtss_f32(tFar) ? enter : FLT_MAX;
+}
+
+} // namespace
+
+void TriangleBVH::Build(const vector<MeshData> &meshes,
+                        const TriangleBVHOptions &options) {
+
+    vector<Vector3> positions;
+    vector<uint32_t> indices;
+    for (const auto &meshData : meshes) {
+        const uint32_t base = uint32_t(positions.size());
+        for (const auto &v : meshData.vertices) {
+            positions.push_back(v.position);
+        }
+        for (const uint32_t i : meshData.indices) {
+            indices.push_back(base + i);
+        }
+    }
+    Build(positions, indices, options);
+}
+
+void TriangleBVH::Build(const vector<Vector3> &positions,
+                        const vector<uint32_t> &indices,
+                        const TriangleBVHOptions &options) {
+
+    m_options = options;
+    m_options.numBins = std::max(m_options.numBins, 2);
+    m_options.maxLeafSize = std::max(m_options.maxLeafSize, 1u);
+
+    const uint32_t numTriangles = uint32_t(indices.size() / 3);
+    m_nodes.clear();
+    m_triangles.clear();
+    m_triangleIds.resize(numTriangles);
+    if (numTriangles == 0) {
+        return;
+    }
+
+    // 삼각형마다 상자와 중심
+    vector<Aabb> boxes(numTriangles);
+    vector<Vector3> centers(numTriangles);
+    for (uint32_t t = 0; t < numTriangles; t++) {
+        for (int k = 0; k < 3; k++) {
+            boxes[t].Grow(positions[indices[t * 3 + k]]);
+        }
+        centers[t] = (boxes[t].min + boxes[t].max) * 0.5f;
+        m_triangleIds[t] = t;
+    }
+
+    auto setBounds = [](Node &node, const Aabb &box) {
+        for (int k = 0; k < 3; k++) {
+            node.min[k] = (&box.min.x)[k];
+            node.max[k] = (&box.max.x)[k];
+        }
+    };
+
+    m_nodes.reserve(size_t(numTriangles) * 2);
+    m_nodes.emplace_back();
+    {
+        Aabb root;
+        for (const auto &box : boxes) {
+            root.Grow(box);
+        }
+        setBounds(m_nodes[0], root);
+        m_nodes[0].leftFirst = 0;
+        m_nodes[0].count = numTriangles;
+    }
+
+    struct Bin {
+        Aabb box;
+        uint32_t count = 0;
+    };
+    const int numBins = m_options.numBins;
+    vector<Bin> bins(numBins);
+    vector<Aabb> rightBoxes(numBins);
+    vector<uint32_t> rightCounts(numBins);
+
+    vector<uint32_t> stack = {0};
+    while (!stack.empty()) {
+        const uint32_t nodeIndex = stack.back();
+        stack.pop_back();
+
+        const uint32_t first = m_nodes[nodeIndex].leftFirst;
+        const uint32_t count = m_nodes[nodeIndex].count;
+        if (count <= 2) {
+            continue;
+        }
+
+        Aabb centerBox;
+        for (uint32_t i = first; i < first + count; i++) {
+            centerBox.Grow(centers[m_triangleIds[i]]);
+        }
+
+        // 축 3개에서 SAH 비용이 가장 작은 경계
+        float bestCost = FLT_MAX;
+        int bestAxis = -1;
+        int bestSplit = 0;
+        Aabb bestLeft, bestRight;
+        for (int axis = 0; axis < 3; axis++) {
+            const float lo = (&centerBox.min.x)[axis];
+            const float range = (&centerBox.max.x)[axis] - lo;
+            if (range <= 0.0f) {
+                continue;
+            }
+            const float scale = numBins / range;
+
+            std::fill(bins.begin(), bins.end(), Bin());
+            for (uint32_t i = first; i < first + count; i++) {
+                const uint32_t t = m_triangleIds[i];
+                const int b = std::min(
+                    int(((&centers[t].x)[axis] - lo) * scale), numBins - 1);
+                bins[b].box.Grow(boxes[t]);
+                bins[b].count++;
+            }
+
+            Aabb right;
+            uint32_t rightCount = 0;
+            for (int b = numBins - 1; b > 0; b--) {
+                right.Grow(bins[b].box);
+                rightCount += bins[b].count;
+                rightBoxes[b] = right;
+                rightCounts[b] = rightCount;
+            }
+
+            Aabb left;
+            uint32_t leftCount = 0;
+            for (int b = 0; b < numBins - 1; b++) {
+                left.Grow(bins[b].box);
+                leftCount += bins[b].count;
+                if (leftCount == 0 || rightCounts[b + 1] == 0) {
+                    continue;
+                }
+                const uint32_t numRight = rightCounts[b + 1];
+                const float cost = leftCount * left.Area() +
+                                   numRight * rightBoxes[b + 1].Area();
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestSplit = b;
+                    bestLeft = left;
+                    bestRight = rightBoxes[b + 1];
+                }
+            }
+        }
+
+        // 리프로 두는 비용과 비교 (노드 표면적으로 정규화)
+        const Node &node = m_nodes[nodeIndex];
+        Aabb nodeBox;
+        nodeBox.min = Vector3(node.min[0], node.min[1], node.min[2]);
+        nodeBox.max = Vector3(node.max[0], node.max[1], node.max[2]);
+        const float nodeArea = std::max(nodeBox.Area(), FLT_MIN);
+        const float splitCost =
+            m_options.traversalCost + bestCost / nodeArea;
+        if (splitCost >= float(count) && count <= m_options.maxLeafSize) {
+            continue;
+        }
+
+        uint32_t mid = first;
+        if (bestAxis >= 0) {
+            const float lo = (&centerBox.min.x)[bestAxis];
+            const float scale =
+                numBins / ((&centerBox.max.x)[bestAxis] - lo);
+            mid = uint32_t(
+                std::partition(
+                    m_triangleIds.begin() + first,
+                    m_triangleIds.begin() + first + count,
+                    [&](uint32_t t) {
+                        const int b = std::min(
+                            int(((&centers[t].x)[bestAxis] - lo) * scale),
+                            numBins - 1);
+                        return b <= bestSplit;
+                    }) -
+                m_triangleIds.begin());
+        }
+
+        // 중심이 모두 같으면 반으로 나눔
+        if (mid == first || mid == first + count) {
+            mid = first + count / 2;
+            bestLeft = Aabb();
+            bestRight = Aabb();
+            for (uint32_t i = first; i < mid; i++) {
+                bestLeft.Grow(boxes[m_triangleIds[i]]);
+            }
+            for (uint32_t i = mid; i < first + count; i++) {
+                bestRight.Grow(boxes[m_triangleIds[i]]);
+            }
+        }
+
+        const uint32_t left = uint32_t(m_nodes.size());
+        m_nodes.resize(m_nodes.size() + 2);
+        setBounds(m_nodes[left], bestLeft);
+        m_nodes[left].leftFirst = first;
+        m_nodes[left].count = mid - first;
+        setBounds(m_nodes[left + 1], bestRight);
+        m_nodes[left + 1].leftFirst = mid;
+        m_nodes[left + 1].count = first + count - mid;
+
+        m_nodes[nodeIndex].leftFirst = left;
+        m_nodes[nodeIndex].count = 0;
+        stack.push_back(left);
+        stack.push_back(left + 1);
+    }
+    m_nodes.shrink_to_fit();
+
+    // 리프에서 연속으로 읽도록 삼각형을 리프 순서로 저장
+    m_triangles.resize(numTriangles);
+    for (uint32_t i = 0; i < numTriangles; i++) {
+        const uint32_t *tri = &indices[m_triangleIds[i] * 3];
+        Triangle &triangle = m_triangles[i];
+        triangle.v0 = positions[tri[0]];
+        triangle.e1 = positions[tri[1]] - triangle.v0;
+        triangle.e2 = positions[tri[2]] - triangle.v0;
+    }
+}
+
+bool TriangleBVH::RayCast(const Vector3 &origin, const Vector3 &dir,
+                          TriangleHit &hit, float maxDistance) const {
+
+    if (m_nodes.empty()) {
+        return false;
+    }
+
+    // 0으로 나누면 무한대가 되어 슬랩 검사가 그대로 동작
+    const __m128 o = _mm_setr_ps(origin.x, origin.y, origin.z, 0.0f);
+    const __m128 invDir =
+        _mm_setr_ps(1.0f / dir.x, 1.0f / dir.y, 1.0f / dir.z, 0.0f);
+
+    float best = maxDistance;
+    uint32_t bestIndex = UINT32_MAX;
+    float bestU = 0.0f, bestV = 0.0f;
+
+    // 보통은 지역 배열로 충분하고, 한쪽으로 치우쳐 깊어진 트리에서만 힙으로
+    // 옮겨서 먼 자식을 버리지 않음
+    uint32_t localStack[64];
+    vector<uint32_t> heapStack;
+    uint32_t *stack = localStack;
+    uint32_t stackCapacity = 64;
+    uint32_t stackSize = 0;
+    const Node *node = &m_nodes[0];
+    if (IntersectNode(node->min, node->max, o, invDir, best) == FLT_MAX) {
+        return false;
+    }
+
+    while (true) {
+        if (node->count) {
+            // Moller-Trumbore (앞뒷면 모두)
+            for (uint32_t i = node->leftFirst;
+                 i < node->leftFirst + node->count; i++) {
+                const Triangle &tri = m_triangles[i];
+                const Vector3 p = dir.Cross(tri.e2);
+                const float det = tri.e1.Dot(p);
+                if (std::abs(det) < 1e-12f) {
+                    continue;
+                }
+                const float invDet = 1.0f / det;
+                const Vector3 s = origin - tri.v0;
+                const float u = s.Dot(p) * invDet;
+                if (u < 0.0f || u > 1.0f) {
+                    continue;
+                }
+                const Vector3 q = s.Cross(tri.e1);
+                const float v = dir.Dot(q) * invDet;
+                if (v < 0.0f || u + v > 1.0f) {
+                    continue;
+                }
+                const float t = tri.e2.Dot(q) * invDet;
+                if (t >= 0.0f && t < best) {
+                    best = t;
+                    bestIndex = i;
+                    bestU = u;
+                    bestV = v;
+                }
+            }
+        } else {
+            // 가까운 자식으로 내려가고 먼 자식은 스택에
+            const Node *child0 = &m_nodes[node->leftFirst];
+            const Node *child1 = child0 + 1;
+            float d0 = IntersectNode(child0->min, child0->max, o, invDir, best);
+            float d1 = IntersectNode(child1->min, child1->max, o, invDir, best);
+            if (d0 > d1) {
+                std::swap(d0, d1);
+                std::swap(child0, child1);
+            }
+            if (d0 != FLT_MAX) {
+                if (d1 != FLT_MAX) {
+                    if (stackSize == stackCapacity) {
+                        if (stack == localStack) {
+                            heapStack.assign(localStack,
+                                             localStack + stackSize);
+                        }
+                        stackCapacity *= 2;
+                        heapStack.resize(stackCapacity);
+                        stack = heapStack.data();
+                    }
+                    stack[stackSize++] = uint32_t(child1 - m_nodes.data());
+                }
+                node = child0;
+                continue;
+            }
+        }
+
+        // 스택에서 꺼낸 노드도 더 가까운 교차가 생겼으면 다시 검사
+        node = nullptr;
+        while (stackSize) {
+            const Node *candidate = &m_nodes[stack[--stackSize]];
+            if (IntersectNode(candidate->min, candidate->max, o, invDir,
+                              best) != FLT_MAX) {
+                node = candidate;
+                break;
+            }
+        }
+        if (!node) {
+            break;
+        }
+    }
+
+    if (bestIndex == UINT32_MAX) {
+        return false;
+    }
+    hit.triangle = m_triangleIds[bestIndex];
+    hit.distance = best;
+    hit.u = bestU;
+    hit.v = bestV;
+    hit.point = origin + dir * best;
+    return true;
+}
+
+size_t TriangleBVH::MemoryBytes() const {
+    return m_nodes.size() * sizeof(Node) +
+           m_triangles.size() * sizeof(Triangle) +
+           m_triangleIds.size() * sizeof(uint32_t);
+}
+
+} // namespace Moon
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cfloat>
+#include <directxtk/SimpleMath.h>
+#include <vector>
+
+#include "MeshData.h"
+
+namespace Moon {
+
+using DirectX::SimpleMath::Vector3;
+
+struct TriangleBVHOptions {
+    int numBins = 16;          // 축마다 SAH를 계산할 구간 개수
+    uint32_t maxLeafSize = 8;  // SAH가 리프를 고르더라도 이보다 많으면 분할
+    float traversalCost = 1.0f; // 삼각형 교차 1회 대비 노드 방문 비용
+};
+
+struct TriangleHit {
+    uint32_t triangle = 0;   // Build()에 넣은 순서의 삼각형 번호
+    float distance = FLT_MAX; // 광선의 매개변수 t (dir이 정규화면 거리)
+    float u = 0.0f;          // 꼭짓점 1의 가중치
+    float v = 0.0f;          // 꼭짓점 2의 가중치 (꼭짓점 0은 1 - u - v)
+    Vector3 point;           // origin + dir * distance
+};
+
+// 삼각형 단위 광선 교차를 위한 BVH (피킹용, CPU에만 존재)
+// 1. 축 3개 모두 binned SAH로 분할 위치를 고르고 분할 비용이 더 크면 리프
+// 2. 노드는 32바이트 (최소/최대 + 자식 또는 삼각형 범위), 자식 둘은 연속
+// 3. 삼각형은 리프 순서로 다시 배치하고 v0, e1, e2를 미리 계산
+// 4. 노드와 광선의 슬랩 검사는 SSE로 세 축을 한꺼번에,
+//    가까운 자식부터 방문하고 더 먼 노드는 건너뜀
+// 참고: Jacco Bikker "How to build a BVH"
+// https://jacco.ompf2.com/2022/04/13/how-to-build-a-bvh-part-1-basics/
+// 참고: Moller, Trumbore "Fast, Minimum Storage Ray/Triangle Intersection"
+
+class TriangleBVH {
+  public:
+    void Build(const std::vector<Vector3> &positions,
+               const std::vector<uint32_t> &indices,
+               const TriangleBVHOptions &options = TriangleBVHOptions());
+
+    // 메쉬들의 LOD0 삼각형을 하나로 (삼각형 번호는 meshes 순서로 이어짐)
+    void Build(const std::vector<MeshData> &meshes,
+               const TriangleBVHOptions &options = TriangleBVHOptions());
+
+    // 가장 가까운 삼각형 (앞뒷면 모두), maxDistance보다 멀면 무시
+    bool RayCast(const Vector3 &origin, const Vector3 &dir, TriangleHit &hit,
+                 float maxDistance = FLT_MAX) const;
+
+    size_t NumTriangles() const { return m_triangles.size(); }
+    size_t NumNodes() const { return m_nodes.size(); }
+    size_t MemoryBytes() const;
+
+  private:
+    struct alignas(32) Node {
+        float min[3];
+        uint32_t leftFirst; // count == 0이면 왼쪽 자식, 아니면 첫 삼각형
+        float max[3];
+        uint32_t count; // 리프의 삼각형 개수 (0이면 내부 노드)
+    };
+
+    struct Triangle {
+        Vector3 v0;
+        Vector3 e1; // v1 - v0
+        Vector3 e2; // v2 - v0
+    };
+
+    TriangleBVHOptions m_options;
+    std::vector<Node> m_nodes;
+    std::vector<Triangle> m_triangles;   // 리프 순서
+    std::vector<uint32_t> m_triangleIds; // 리프 순서 -> 원래 삼각형 번호
+};
+
+} // namespace Moon
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <DirectXMath.h>
+#include <directxtk/SimpleMath.h>
+
+namespace Moon {
+
+// 벡터 4개의 같은 성분을 XMVECTOR 하나에 모은 SoA 벡터
+// 삼각형 4개를 한 번에 계산할 때 사용 (TangentGenerator, NormalGenerator)
+
+struct Vec3x4 {
+    DirectX::XMVECTOR x, y, z;
+};
+
+inline Vec3x4 Load3x4(const DirectX::SimpleMath::Vector3 v[4]) {
+    using namespace DirectX;
+    return {XMVectorSet(v[0].x, v[1].x, v[2].x, v[3].x),
+            XMVectorSet(v[0].y, v[1].y, v[2].y, v[3].y),
+            XMVectorSet(v[0].z, v[1].z, v[2].z, v[3].z)};
+}
+
+// 앞의 count개만 저장
+inline void Store3x4(const Vec3x4 &a, DirectX::SimpleMath::Vector3 *out,
+                     size_t count, size_t stride = 1) {
+    using namespace DirectX;
+    XMFLOAT4 x, y, z;
+    XMStoreFloat4(&x, a.x);
+    XMStoreFloat4(&y, a.y);
+    XMStoreFloat4(&z, a.z);
+    const float xs[4] = {x.x, x.y, x.z, x.w};
+    const float ys[4] = {y.x, y.y, y.z, y.w};
+    const float zs[4] = {z.x, z.y, z.z, z.w};
+    for (size_t k = 0; k < count; k++) {
+        out[k * stride] = DirectX::SimpleMath::Vector3(xs[k], ys[k], zs[k]);
+    }
+}
+
+inline Vec3x4 Sub(const Vec3x4 &a, const Vec3x4 &b) {
+    using namespace DirectX;
+    return {XMVectorSubtract(a.x, b.x), XMVectorSubtract(a.y, b.y),
+            XMVectorSubtract(a.z, b.z)};
+}
+
+inline Vec3x4 Scale(const Vec3x4 &a, DirectX::FXMVECTOR s) {
+    using namespace DirectX;
+    return {XMVectorMultiply(a.x, s), XMVectorMultiply(a.y, s),
+            XMVectorMultiply(a.z, s)};
+}
+
+inline DirectX::XMVECTOR Dot(const Vec3x4 &a, const Vec3x4 &b) {
+    using namespace DirectX;
+    return XMVectorMultiplyAdd(
+        a.x, b.x, XMVectorMultiplyAdd(a.y, b.y, XMVectorMultiply(a.z, b.z)));
+}
+
+inline Vec3x4 Cross(const Vec3x4 &a, const Vec3x4 &b) {
+    using namespace DirectX;
+    return {XMVectorNegativeMultiplySubtract(a.z, b.y,
+                                             XMVectorMultiply(a.y, b.z)),
+            XMVectorNegativeMultiplySubtract(a.x, b.z,
+                                             XMVectorMultiply(a.z, b.x)),
+            XMVectorNegativeMultiplySubtract(a.y, b.x,
+                                             XMVectorMultiply(a.x, b.y))};
+}
+
+inline DirectX::XMVECTOR Length(const Vec3x4 &a) {
+    return DirectX::XMVectorSqrt(Dot(a, a));
+}
+
+// 길이가 0에 가까우면 0 벡터
+inline Vec3x4 Normalize(const Vec3x4 &a) {
+    using namespace DirectX;
+    const XMVECTOR lengthSq = Dot(a, a);
+    const XMVECTOR valid = XMVectorGreater(lengthSq, XMVectorReplicate(1e-20f));
+    const XMVECTOR inv = XMVectorSelect(
+        XMVectorZero(), XMVectorReciprocalSqrt(lengthSq), valid);
+    return Scale(a, inv);
+}
+
+// 정규화된 두 벡터 사이의 각도
+inline DirectX::XMVECTOR AngleBetweenNormals(const Vec3x4 &a,
+                                             const Vec3x4 &b) {
+    using namespace DirectX;
+    return XMVectorACos(XMVectorClamp(Dot(a, b), XMVectorReplicate(-1.0f),
+                                      XMVectorReplicate(1.0f)));
+}
+
+} // namespace Moon
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <directxtk/SimpleMath.h>
 #include <vector>
 
@@ -17,4 +18,13 @@ struct Vertex {
     // biTangent는 쉐이더에서 계산
 };
 
+// 압축된 버텍스 (44 -> 20 바이트), VertexPacker로 변환
+// "Common.hlsli"의 PackedVertexShaderInput과 같은 순서
+struct PackedVertex {
+    uint16_t position[4]; // UNORM16, 메쉬 AABB 기준 (w는 사용 안함)
+    int16_t normal[2];    // SNORM16, Octahedral
+    int16_t tangent[2];   // SNORM16, Octahedral
+    uint16_t texcoord[2]; // half float
+};
+
 } // namespace hlab
\ No newline at end of file
@@ -0,0 +1,158 @@
+#include "VertexPacker.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <fp16.h>
+
+namespace Moon {
+
+using namespace std;
+
+namespace {
+
+uint16_t ToUnorm16(float x) {
+    return uint16_t(lroundf(clamp(x, 0.0f, 1.0f) * 65535.0f));
+}
+
+float FromUnorm16(uint16_t x) { return float(x) / 65535.0f; }
+
+int16_t ToSnorm16(float x) {
+    return int16_t(lroundf(clamp(x, -1.0f, 1.0f) * 32767.0f));
+}
+
+// D3D의 SNORM 변환 규칙: -32768도 -1.0
+float FromSnorm16(int16_t x) { return max(float(x) / 32767.0f, -1.0f); }
+
+float SignNotZero(float x) { return x >= 0.0f ? 1.0f : -1.0f; }
+
+float AngleBetween(const Vector3 &a, const Vector3 &b) {
+    Vector3 na = a, nb = b;
+    na.Normalize();
+    nb.Normalize();
+    return DirectX::XMConvertToDegrees(
+        acosf(clamp(na.Dot(nb), -1.0f, 1.0f)));
+}
+
+} // namespace
+
+Vector2 VertexPacker::EncodeOctahedral(const Vector3 &n) {
+
+    // 팔면체에 투영한 후 아래쪽 반은 바깥쪽 삼각형들로 접어서 펼침
+    const float l1 = fabs(n.x) + fabs(n.y) + fabs(n.z);
+    if (l1 <= 0.0f) {
+        return Vector2(0.0f);
+    }
+
+    Vector2 e(n.x / l1, n.y / l1);
+    if (n.z < 0.0f) {
+        e = Vector2((1.0f - fabs(e.y)) * SignNotZero(e.x),
+                    (1.0f - fabs(e.x)) * SignNotZero(e.y));
+    }
+    return e;
+}
+
+Vector3 VertexPacker::DecodeOctahedral(const Vector2 &e) {
+
+    // "Common.hlsli"의 DecodeOctahedral()과 같은 계산
+    Vector3 n(e.x, e.y, 1.0f - fabs(e.x) - fabs(e.y));
+    const float t = max(-n.z, 0.0f);
+    n.x += n.x >= 0.0f ? -t : t;
+    n.y += n.y >= 0.0f ? -t : t;
+    n.Normalize();
+    return n;
+}
+
+PackingBounds VertexPacker::ComputeBounds(const vector<Vertex> &vertices) {
+
+    Vector3 vmin(FLT_MAX), vmax(-FLT_MAX);
+    for (const auto &v : vertices) {
+        vmin = Vector3::Min(vmin, v.position);
+        vmax = Vector3::Max(vmax, v.position);
+    }
+
+    PackingBounds bounds;
+    if (!vertices.empty()) {
+        bounds.positionMin = vmin;
+        bounds.positionExtent = vmax - vmin;
+    }
+    return bounds;
+}
+
+PackedVertex VertexPacker::Pack(const Vertex &v, const PackingBounds &bounds) {
+
+    PackedVertex p;
+
+    const Vector3 &extent = bounds.positionExtent;
+    const Vector3 offset = v.position - bounds.positionMin;
+    p.position[0] = ToUnorm16(extent.x > 0.0f ? offset.x / extent.x : 0.0f);
+    p.position[1] = ToUnorm16(extent.y > 0.0f ? offset.y / extent.y : 0.0f);
+    p.position[2] = ToUnorm16(extent.z > 0.0f ? offset.z / extent.z : 0.0f);
+    p.position[3] = 0;
+
+    const Vector2 n = EncodeOctahedral(v.normalModel);
+    p.normal[0] = ToSnorm16(n.x);
+    p.normal[1] = ToSnorm16(n.y);
+
+    const Vector2 t = EncodeOctahedral(v.tangentModel);
+    p.tangent[0] = ToSnorm16(t.x);
+    p.tangent[1] = ToSnorm16(t.y);
+
+    p.texcoord[0] = fp16_ieee_from_fp32_value(v.texcoord.x);
+    p.texcoord[1] = fp16_ieee_from_fp32_value(v.texcoord.y);
+
+    return p;
+}
+
+Vertex VertexPacker::Unpack(const PackedVertex &p,
+                            const PackingBounds &bounds) {
+    Vertex v;
+    v.position = bounds.positionMin +
+                 Vector3(FromUnorm16(p.position[0]), FromUnorm16(p.position[1]),
+                         FromUnorm16(p.position[2])) *
+                     bounds.positionExtent;
+    v.normalModel = DecodeOctahedral(
+        Vector2(FromSnorm16(p.normal[0]), FromSnorm16(p.normal[1])));
+    v.tangentModel = DecodeOctahedral(
+        Vector2(FromSnorm16(p.tangent[0]), FromSnorm16(p.tangent[1])));
+    v.texcoord = Vector2(fp16_ieee_to_fp32_value(p.texcoord[0]),
+                         fp16_ieee_to_fp32_value(p.texcoord[1]));
+    return v;
+}
+
+void VertexPacker::Pack(const vector<Vertex> &vertices,
+                        const PackingBounds &bounds,
+                        vector<PackedVertex> &packed) {
+    packed.resize(vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++) {
+        packed[i] = Pack(vertices[i], bounds);
+    }
+}
+
+PackingError VertexPacker::MeasureError(const vector<Vertex> &vertices,
+                                        const vector<PackedVertex> &packed,
+                                        const PackingBounds &bounds) {
+    PackingError error;
+    for (size_t i = 0; i < min(vertices.size(), packed.size()); i++) {
+        const Vertex &v = vertices[i];
+        const Vertex u = Unpack(packed[i], bounds);
+
+        error.position =
+            max(error.position, (v.position - u.position).Length());
+        error.texcoord =
+            max(error.texcoord, (v.texcoord - u.texcoord).Length());
+
+        // 길이가 0인 벡터(노멀/탄젠트가 없는 경우)는 제외
+        if (v.normalModel.LengthSquared() > 1e-12f) {
+            error.normal =
+                max(error.normal, AngleBetween(v.normalModel, u.normalModel));
+        }
+        if (v.tangentModel.LengthSquared() > 1e-12f) {
+            error.tangent = max(error.tangent,
+                                AngleBetween(v.tangentModel, u.tangentModel));
+        }
+    }
+    return error;
+}
+
+} // namespace Moon
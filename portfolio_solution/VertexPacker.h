@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Vertex.h"
+
+namespace Moon {
+
+// Vertex <-> PackedVertex 변환과 압축 오차 측정
+// 위치: AABB 안에서 16비트 정규화 (오차는 AABB 크기 / 65535 / 2 이하)
+// 노멀/탄젠트: Octahedral 인코딩 후 16비트 SNORM 두 개
+// 텍스춰 좌표: half float
+// 참고: Cigolle et al. "A Survey of Efficient Representations for
+// Independent Unit Vectors" (2014)
+// https://jcgt.org/published/0003/02/01/
+
+// 위치 복원: position = positionMin + unorm * positionExtent
+struct PackingBounds {
+    Vector3 positionMin = Vector3(0.0f);
+    Vector3 positionExtent = Vector3(1.0f);
+};
+
+// 압축 후 다시 풀었을 때의 최대 오차
+struct PackingError {
+    float position = 0.0f; // 모델 좌표계 거리
+    float normal = 0.0f;   // 단위: 도
+    float tangent = 0.0f;  // 단위: 도
+    float texcoord = 0.0f; // UV 거리
+};
+
+class VertexPacker {
+  public:
+    static PackingBounds ComputeBounds(const std::vector<Vertex> &vertices);
+
+    static PackedVertex Pack(const Vertex &v, const PackingBounds &bounds);
+    static Vertex Unpack(const PackedVertex &v, const PackingBounds &bounds);
+
+    static void Pack(const std::vector<Vertex> &vertices,
+                     const PackingBounds &bounds,
+                     std::vector<PackedVertex> &packed);
+
+    static PackingError MeasureError(const std::vector<Vertex> &vertices,
+                                     const std::vector<PackedVertex> &packed,
+                                     const PackingBounds &bounds);
+
+    // 단위 벡터 <-> [-1, 1]^2
+    static Vector2 EncodeOctahedral(const Vector3 &n);
+    static Vector3 DecodeOctahedral(const Vector2 &e);
+};
+
+} // namespace Moon
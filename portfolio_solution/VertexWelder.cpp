@@ -0,0 +1,165 @@
+#include "VertexWelder.h"
+
+#include <cmath>
+#include <iostream>
+#include <unordered_map>
+
+namespace Moon {
+
+using namespace std;
+using DirectX::SimpleMath::Vector2;
+using DirectX::SimpleMath::Vector3;
+
+namespace {
+
+bool NearlyEqual(const Vector3 &a, const Vector3 &b, float epsilon) {
+    return fabsf(a.x - b.x) <= epsilon && fabsf(a.y - b.y) <= epsilon &&
+           fabsf(a.z - b.z) <= epsilon;
+}
+
+bool NearlyEqual(const Vector2 &a, const Vector2 &b, float epsilon) {
+    return fabsf(a.x - b.x) <= epsilon && fabsf(a.y - b.y) <= epsilon;
+}
+
+bool IsSameVertex(const Vertex &a, const Vertex &b, const WeldOptions &o,
+                  float positionEpsilon) {
+    return NearlyEqual(a.position, b.position, positionEpsilon) &&
+           NearlyEqual(a.normalModel, b.normalModel, o.normalEpsilon) &&
+           NearlyEqual(a.texcoord, b.texcoord, o.texcoordEpsilon) &&
+           NearlyEqual(a.tangentModel, b.tangentModel, o.tangentEpsilon);
+}
+
+// 격자 좌표를 자르지 않고 그대로 키로 사용 (멀리 떨어진 셀이 겹치지 않음)
+struct Cell {
+    int64_t x, y, z;
+    bool operator==(const Cell &other) const {
+        return x == other.x && y == other.y && z == other.z;
+    }
+};
+
+// Teschner et al. "Optimized Spatial Hashing for Collision Detection of
+// Deformable Objects" (VMV 2003)
+struct CellHash {
+    size_t operator()(const Cell &c) const {
+        const uint64_t h = (uint64_t(c.x) * 73856093ull) ^
+                           (uint64_t(c.y) * 19349663ull) ^
+                           (uint64_t(c.z) * 83492791ull);
+        return size_t(h ^ (h >> 32));
+    }
+};
+
+} // namespace
+
+size_t VertexWelder::Weld(MeshData &meshData, const WeldOptions &options) {
+
+    auto &vertices = meshData.vertices;
+    auto &indices = meshData.indices;
+
+    if (vertices.empty()) {
+        return 0;
+    }
+
+    // 위치 허용 오차는 AABB의 가장 긴 변에 대한 비율 (메시 크기와 무관)
+    Vector3 minPos = vertices[0].position;
+    Vector3 maxPos = vertices[0].position;
+    for (const auto &v : vertices) {
+        minPos = Vector3::Min(minPos, v.position);
+        maxPos = Vector3::Max(maxPos, v.position);
+    }
+    const Vector3 extent = maxPos - minPos;
+    const float size = fmaxf(extent.x, fmaxf(extent.y, extent.z));
+    const float positionEpsilon = options.positionEpsilon * size;
+
+    // 격자 크기가 허용 오차 이상이면 같은 버텍스는 이웃한 셀 안에 있음
+    // (모든 점이 한 곳에 있으면 size가 0이므로 셀 하나)
+    const float cellSize =
+        size > 0.0f ? fmaxf(positionEpsilon, size * 1e-7f) : 1.0f;
+    const double invCellSize = 1.0 / double(cellSize);
+
+    // 셀마다 (첫 버텍스) -> next로 이어지는 리스트
+    unordered_map<Cell, uint32_t, CellHash> cellHeads;
+    cellHeads.reserve(vertices.size());
+    vector<uint32_t> next;
+    next.reserve(vertices.size());
+
+    vector<Vertex> welded;
+    welded.reserve(vertices.size());
+    vector<uint32_t> remap(vertices.size());
+
+    const uint32_t none = uint32_t(-1);
+
+    for (size_t i = 0; i < vertices.size(); i++) {
+        const Vertex &v = vertices[i];
+
+        const int64_t cx = int64_t(floor((v.position.x - minPos.x) *
+                                         invCellSize));
+        const int64_t cy = int64_t(floor((v.position.y - minPos.y) *
+                                         invCellSize));
+        const int64_t cz = int64_t(floor((v.position.z - minPos.z) *
+                                         invCellSize));
+
+        uint32_t found = none;
+        for (int64_t dz = -1; dz <= 1 && found == none; dz++) {
+            for (int64_t dy = -1; dy <= 1 && found == none; dy++) {
+                for (int64_t dx = -1; dx <= 1 && found == none; dx++) {
+                    auto it = cellHeads.find({cx + dx, cy + dy, cz + dz});
+                    if (it == cellHeads.end()) {
+                        continue;
+                    }
+                    for (uint32_t j = it->second; j != none; j = next[j]) {
+                        if (IsSameVertex(v, welded[j], options,
+                                         positionEpsilon)) {
+                            found = j;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        if (found == none) {
+            found = uint32_t(welded.size());
+            welded.push_back(v);
+
+            auto result = cellHeads.insert({Cell{cx, cy, cz}, found});
+            if (result.second) {
+                next.push_back(none);
+            } else {
+                next.push_back(result.first->second);
+                result.first->second = found;
+            }
+        }
+
+        remap[i] = found;
+    }
+
+    for (auto &index : indices) {
+        index = remap[index];
+    }
+
+    const size_t before = vertices.size();
+    const size_t after = welded.size();
+
+    if (options.printStats) {
+        cout << "Weld vertices " << before << " -> " << after << " ("
+             << before * sizeof(Vertex) << " -> " << after * sizeof(Vertex)
+             << " bytes)" << endl;
+    }
+
+    vertices = std::move(welded);
+
+    return before - after;
+}
+
+size_t VertexWelder::Weld(vector<MeshData> &meshes,
+                          const WeldOptions &options) {
+
+    size_t removed = 0;
+    for (auto &mesh : meshes) {
+        removed += Weld(mesh, options);
+    }
+
+    return removed;
+}
+
+} // namespace Moon
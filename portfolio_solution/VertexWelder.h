@@ -0,0 +1,29 @@
+#pragma once
+
+#include "MeshData.h"
+
+namespace Moon {
+
+// 위치/노멀/텍스춰 좌표/탄젠트가 모두 허용 오차 안에 있는 버텍스들을
+// 하나로 합치고 인덱스를 다시 만듦
+// 공간 해시(격자 크기 = 위치 허용 오차)로 가까운 버텍스만 비교
+
+struct WeldOptions {
+    float positionEpsilon = 1e-6f; // AABB의 가장 긴 변에 대한 비율
+    float normalEpsilon = 1e-3f;
+    float texcoordEpsilon = 1e-5f;
+    float tangentEpsilon = 1e-3f;
+    bool printStats = false; // 전후 버텍스 개수와 메모리 출력
+};
+
+class VertexWelder {
+  public:
+    // 반환값: 줄어든 버텍스 개수
+    static size_t Weld(MeshData &meshData,
+                       const WeldOptions &options = WeldOptions());
+
+    static size_t Weld(std::vector<MeshData> &meshes,
+                       const WeldOptions &options = WeldOptions());
+};
+
+} // namespace Moon